@@ -10,6 +10,14 @@ struct Timer
   Timer() : start_time(std::chrono::high_resolution_clock::now()) {}
   auto stop() { stop_time = std::chrono::high_resolution_clock::now(); }
 
+  // Start timing again after stop(), accumulating with the time
+  // before.  The time between stop() and resume() is not counted, so
+  // start_time moves forward by that much.
+  void resume()
+  {
+    start_time += std::chrono::high_resolution_clock::now() - stop_time;
+  }
+
   int64_t elapsed_milliseconds() const
   {
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time
@@ -402,7 +402,8 @@ compute_optimal(const std::vector<Positive_Matrix_With_Prefactor> &matrices,
             }
         }
 
-      Block_Info block_info(matrix_dimensions, parameters.procs_per_node,
+      Block_Info block_info(El::mpi::COMM_WORLD, matrix_dimensions,
+                            parameters.procs_per_node,
                             parameters.proc_granularity, parameters.verbosity);
       El::Grid grid(block_info.mpi_comm.value);
 
@@ -72,6 +72,10 @@ int main(int argc, char **argv)
   // El::gmp wants base-2 bits, but boost::multiprecision wants
   // base-10 digits.
   Boost_Float::default_precision(precision * log(2) / log(10));
+  if(parameters.algorithmic_block_size != 0)
+    {
+      El::SetBlocksize(parameters.algorithmic_block_size);
+    }
 
   if(parameters.verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
     {
@@ -1,6 +1,22 @@
 #pragma once
 
 #include "sdp_read/read_input.hxx"
+#include "sdp_convert/Dual_Constraint_Group.hxx"
+#include "Timers.hxx"
 
 std::vector<boost::filesystem::path>
 read_file_list(const boost::filesystem::path &input_file);
+
+int64_t max_degree(const Positive_Matrix_With_Prefactor &matrix);
+
+void convert_objectives(const std::vector<El::BigFloat> &objectives,
+                        const std::vector<El::BigFloat> &normalization,
+                        size_t &max_index, El::BigFloat &objective_const,
+                        std::vector<El::BigFloat> &dual_objective_b);
+
+Dual_Constraint_Group
+to_dual_constraint_group(const Positive_Matrix_With_Prefactor &matrix,
+                         const std::vector<El::BigFloat> &normalization,
+                         const size_t &max_index,
+                         const std::string &timer_prefix,
+                         const size_t &block_index, Timers &timers);
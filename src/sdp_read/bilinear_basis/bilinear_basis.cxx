@@ -1,4 +1,4 @@
-#include "../../../sdp_read.hxx"
+#include "../../sdp_read.hxx"
 
 void precompute(
   const Boost_Float &base, std::vector<Boost_Float> &sorted_poles,
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../../../../Boost_Float.hxx"
+#include "../../../Boost_Float.hxx"
 
 #include <map>
 #include <vector>
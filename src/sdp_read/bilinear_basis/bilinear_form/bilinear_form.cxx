@@ -1,6 +1,6 @@
 #include "../factorial.hxx"
-#include "../../../../sdp_read.hxx"
-#include "../../../../Timers.hxx"
+#include "../../../sdp_read.hxx"
+#include "../../../Timers.hxx"
 
 #include <boost/math/tools/polynomial.hpp>
 
@@ -0,0 +1,49 @@
+#include <El.hpp>
+
+#include <vector>
+
+// The normalization condition n.y = 1 is used to eliminate the
+// component of y with the largest |n_i|.  That component, max_index,
+// becomes the constant term of the objective, and the remaining
+// objectives become b.
+
+void convert_objectives(const std::vector<El::BigFloat> &objectives,
+                        const std::vector<El::BigFloat> &normalization,
+                        size_t &max_index, El::BigFloat &objective_const,
+                        std::vector<El::BigFloat> &dual_objective_b)
+{
+  if(objectives.size() != normalization.size())
+    {
+      throw std::runtime_error(
+        "Incompatible objectives and normalization.  The objectives have "
+        + std::to_string(objectives.size())
+        + " elements, but the normalization has "
+        + std::to_string(normalization.size()));
+    }
+  if(normalization.empty())
+    {
+      throw std::runtime_error("The normalization is empty");
+    }
+
+  auto max_normalization(normalization.begin());
+  for(auto n(normalization.begin()); n != normalization.end(); ++n)
+    {
+      if(Abs(*n) > Abs(*max_normalization))
+        {
+          max_normalization = n;
+        }
+    }
+  max_index = std::distance(normalization.begin(), max_normalization);
+
+  objective_const = objectives.at(max_index) / normalization.at(max_index);
+  dual_objective_b.clear();
+  dual_objective_b.reserve(normalization.size() - 1);
+  for(size_t index = 0; index < normalization.size(); ++index)
+    {
+      if(index != max_index)
+        {
+          dual_objective_b.push_back(
+            objectives.at(index) - normalization.at(index) * objective_const);
+        }
+    }
+}
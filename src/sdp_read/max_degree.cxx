@@ -0,0 +1,15 @@
+#include "Positive_Matrix_With_Prefactor.hxx"
+
+#include <algorithm>
+
+int64_t max_degree(const Positive_Matrix_With_Prefactor &matrix)
+{
+  int64_t result(0);
+  for(auto &pvv : matrix.polynomials)
+    for(auto &pv : pvv)
+      for(auto &polynomial : pv)
+        {
+          result = std::max(result, polynomial.degree());
+        }
+  return result;
+}
@@ -1,4 +1,4 @@
-#include "../../Boost_Float.hxx"
+#include "../Boost_Float.hxx"
 
 #include <El.hpp>
 
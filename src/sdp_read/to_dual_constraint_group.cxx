@@ -0,0 +1,115 @@
+#include "../sdp_read.hxx"
+
+std::vector<Polynomial> bilinear_basis(const Damped_Rational &damped_rational,
+                                       const size_t &half_max_degree);
+
+std::vector<Boost_Float> sample_points(const size_t &num_points);
+
+// Convert one positive matrix into the constraints of one block of
+// the SDP.  The component max_index of the polynomial vectors is
+// eliminated with the normalization, as in convert_objectives.
+// Timers are named timer_prefix.scalings_<block_index>, etc.
+
+Dual_Constraint_Group
+to_dual_constraint_group(const Positive_Matrix_With_Prefactor &matrix,
+                         const std::vector<El::BigFloat> &normalization,
+                         const size_t &max_index,
+                         const std::string &timer_prefix,
+                         const size_t &block_index, Timers &timers)
+{
+  const std::string suffix("_" + std::to_string(block_index));
+  auto &scalings_timer(
+    timers.add_and_start(timer_prefix + ".scalings" + suffix));
+  const size_t degree(max_degree(matrix));
+  std::vector<Boost_Float> points(sample_points(degree + 1)),
+    sample_scalings;
+
+  sample_scalings.reserve(points.size());
+  for(auto &point : points)
+    {
+      Boost_Float numerator(matrix.damped_rational.constant
+                            * pow(matrix.damped_rational.base, point));
+      Boost_Float denominator(1);
+      for(auto &pole : matrix.damped_rational.poles)
+        {
+          denominator *= (point - pole);
+        }
+      sample_scalings.push_back(numerator / denominator);
+    }
+  scalings_timer.stop();
+
+  Polynomial_Vector_Matrix pvm;
+  pvm.rows = matrix.polynomials.size();
+  pvm.cols = matrix.polynomials.front().size();
+
+  auto &bilinear_basis_timer(
+    timers.add_and_start(timer_prefix + ".bilinear_basis" + suffix));
+
+  pvm.bilinear_basis = bilinear_basis(matrix.damped_rational, degree / 2);
+
+  bilinear_basis_timer.stop();
+
+  pvm.sample_points.reserve(points.size());
+  for(auto &point : points)
+    {
+      pvm.sample_points.emplace_back(to_string(point));
+    }
+  pvm.sample_scalings.reserve(sample_scalings.size());
+  for(auto &scaling : sample_scalings)
+    {
+      pvm.sample_scalings.emplace_back(to_string(scaling));
+    }
+
+  auto &pvm_timer(timers.add_and_start(timer_prefix + ".pvm" + suffix));
+  pvm.elements.reserve(pvm.rows * pvm.cols);
+  for(auto &pvv : matrix.polynomials)
+    for(auto &pv : pvv)
+      {
+        pvm.elements.emplace_back();
+        auto &pvm_polynomials(pvm.elements.back());
+        pvm_polynomials.reserve(pv.size());
+        pvm_polynomials.push_back(pv.at(max_index)
+                                  / normalization.at(max_index));
+        auto &pvm_constant(pvm_polynomials.back());
+
+        for(size_t index = 0; index < normalization.size(); ++index)
+          {
+            if(index != max_index)
+              {
+                pvm_polynomials.emplace_back(0, 0);
+                auto &pvm_poly(pvm_polynomials.back());
+                pvm_poly.coefficients.reserve(pv.at(index).degree() + 1);
+                size_t coefficient(0);
+                for(; coefficient < pv.at(index).coefficients.size()
+                      && coefficient < pvm_constant.coefficients.size();
+                    ++coefficient)
+                  {
+                    pvm_poly.coefficients.push_back(
+                      pv.at(index).coefficients[coefficient]
+                      - normalization.at(index)
+                          * pvm_constant.coefficients[coefficient]);
+                  }
+                for(; coefficient < pv.at(index).coefficients.size();
+                    ++coefficient)
+                  {
+                    pvm_poly.coefficients.push_back(
+                      pv.at(index).coefficients[coefficient]);
+                  }
+                for(; coefficient < pvm_constant.coefficients.size();
+                    ++coefficient)
+                  {
+                    pvm_poly.coefficients.push_back(
+                      -normalization.at(index)
+                      * pvm_polynomials.at(0).coefficients[coefficient]);
+                  }
+              }
+          }
+      }
+  pvm_timer.stop();
+
+  auto &dual_constraint_timer(
+    timers.add_and_start(timer_prefix + ".dual_constraint" + suffix));
+  Dual_Constraint_Group result(pvm);
+  dual_constraint_timer.stop();
+  return result;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+// A model of the time that one iteration spends on one block of the
+// Schur complement, used to balance blocks without a timing run.  It
+// models the same kernels that a timing run measures (see
+// write_timing).  For a block with dimension m and degree d, let
+// s = m(m+1)/2 (d+1) be the size of the Schur complement block and N
+// the number of free variables.  The time is
+//
+//   cholesky * s^3/3                  Cholesky of the Schur block
+//   trsm     * s^2 N                  L^{-1} B
+//   syrk     * s N(N+1)/2             Q += (L^{-1} B)^T L^{-1} B
+//
+// The constants are the time in nanoseconds for one multiply-add at
+// the given precision, and are different for every machine, so there
+// are no defaults.  At other precisions, the time per multiply-add
+// scales as precision^precision_exponent.
+struct Block_Cost_Model
+{
+  double cholesky, trsm, syrk;
+  size_t precision;
+  double precision_exponent;
+
+  // Read the constants from a file in key=value format.  Every key,
+  // cholesky, trsm, syrk, precision and precisionExponent, is
+  // required.
+  explicit Block_Cost_Model(const boost::filesystem::path &model_path);
+
+  double milliseconds(const size_t &dimension, const size_t &degree,
+                      const size_t &num_free_vars,
+                      const size_t &actual_precision) const;
+};
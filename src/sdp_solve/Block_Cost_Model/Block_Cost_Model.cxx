@@ -0,0 +1,44 @@
+#include "../Block_Cost_Model.hxx"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+namespace po = boost::program_options;
+
+Block_Cost_Model::Block_Cost_Model(const boost::filesystem::path &model_path)
+{
+  po::options_description options;
+  options.add_options()("cholesky",
+                        po::value<double>(&cholesky)->required());
+  options.add_options()("trsm", po::value<double>(&trsm)->required());
+  options.add_options()("syrk", po::value<double>(&syrk)->required());
+  options.add_options()("precision",
+                        po::value<size_t>(&precision)->required());
+  options.add_options()("precisionExponent",
+                        po::value<double>(&precision_exponent)->required());
+
+  boost::filesystem::ifstream model_stream(model_path);
+  if(!model_stream.good())
+    {
+      throw std::runtime_error("Could not open '" + model_path.string()
+                               + "'");
+    }
+  try
+    {
+      po::variables_map variables_map;
+      po::store(po::parse_config_file(model_stream, options), variables_map);
+      po::notify(variables_map);
+    }
+  catch(po::error &e)
+    {
+      throw std::runtime_error("Invalid block cost model '"
+                               + model_path.string() + "': " + e.what());
+    }
+  if(precision == 0 || cholesky < 0 || trsm < 0 || syrk < 0)
+    {
+      throw std::runtime_error(
+        "Invalid block cost model '" + model_path.string()
+        + "': the precision must be positive, and the costs must not be "
+          "negative");
+    }
+}
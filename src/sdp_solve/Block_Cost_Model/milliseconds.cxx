@@ -0,0 +1,17 @@
+#include "../Block_Cost_Model.hxx"
+
+#include <cmath>
+
+double Block_Cost_Model::milliseconds(const size_t &dimension,
+                                      const size_t &degree,
+                                      const size_t &num_free_vars,
+                                      const size_t &actual_precision) const
+{
+  const double m(dimension), N(num_free_vars),
+    s(m * (m + 1) / 2 * (degree + 1));
+  const double nanoseconds(cholesky * s * s * s / 3 + trsm * s * s * N
+                           + syrk * s * N * (N + 1) / 2);
+  return nanoseconds * 1e-6
+         * std::pow(double(actual_precision) / precision,
+                    precision_exponent);
+}
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "elementwise.hxx"
+
 #include <El.hpp>
 
 #include <list>
@@ -64,15 +66,25 @@ public:
   {
     for(auto &block : blocks)
       {
-        ShiftDiagonal(block, c);
+        elementwise_shift_diagonal(c, block);
       }
   }
 
+  // Blocks that are aligned the same way, which is the usual case,
+  // are combined using only local data.
   void operator+=(const Block_Diagonal_Matrix &A)
   {
     for(size_t b = 0; b < blocks.size(); b++)
       {
-        blocks[b] += A.blocks[b];
+        if(is_aligned(blocks[b], A.blocks[b]))
+          {
+            elementwise_axpy(El::BigFloat(1), A.blocks[b].LockedMatrix(),
+                             blocks[b].Matrix());
+          }
+        else
+          {
+            blocks[b] += A.blocks[b];
+          }
       }
   }
 
@@ -80,7 +92,15 @@ public:
   {
     for(size_t b = 0; b < blocks.size(); b++)
       {
-        blocks[b] -= A.blocks[b];
+        if(is_aligned(blocks[b], A.blocks[b]))
+          {
+            elementwise_axpy(El::BigFloat(-1), A.blocks[b].LockedMatrix(),
+                             blocks[b].Matrix());
+          }
+        else
+          {
+            blocks[b] -= A.blocks[b];
+          }
       }
   }
 
@@ -88,7 +108,7 @@ public:
   {
     for(auto &block : blocks)
       {
-        block *= c;
+        elementwise_scale(c, block.Matrix());
       }
   }
 
@@ -121,5 +141,12 @@ public:
 
   friend std::ostream &
   operator<<(std::ostream &os, const Block_Diagonal_Matrix &A);
+
+private:
+  static bool is_aligned(const El::DistMatrix<El::BigFloat> &A,
+                         const El::DistMatrix<El::BigFloat> &B)
+  {
+    return A.ColAlign() == B.ColAlign() && A.RowAlign() == B.RowAlign();
+  }
 };
 
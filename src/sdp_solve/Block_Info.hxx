@@ -42,6 +42,11 @@ struct MPI_Group_Wrapper
 class Block_Info
 {
 public:
+  // All of the processes working on this SDP.  This is COMM_WORLD,
+  // unless several SDPs are solved at once (see sdpb's
+  // packedSdpDirs).  Block_Info does not own it.
+  El::mpi::Comm solver_comm;
+
   boost::filesystem::path block_timings_filename;
   size_t file_num_procs;
   std::vector<std::vector<size_t>> file_block_indices;
@@ -66,16 +71,31 @@ public:
   MPI_Group_Wrapper mpi_group;
   MPI_Comm_Wrapper mpi_comm;
 
+  // Ranks are assigned to nodes in contiguous chunks of
+  // procs_per_node.  node_comm holds all of the ranks on this node.
+  // inter_node_comm holds the ranks on every node that have the same
+  // rank within their node as this rank.
+  size_t procs_per_node;
+  MPI_Comm_Wrapper node_comm, inter_node_comm;
+
   Block_Info() = delete;
-  Block_Info(const boost::filesystem::path &sdp_directory,
+  Block_Info(const El::mpi::Comm &solver_comm,
+             const boost::filesystem::path &sdp_directory,
              const boost::filesystem::path &checkpoint_in,
              const size_t &procs_per_node, const size_t &proc_granularity,
              const Verbosity &verbosity);
-  Block_Info(const boost::filesystem::path &sdp_directory,
+  Block_Info(const El::mpi::Comm &solver_comm,
+             const boost::filesystem::path &sdp_directory,
              const El::Matrix<int32_t> &block_timings,
              const size_t &procs_per_node, const size_t &proc_granularity,
              const Verbosity &verbosity);
-  Block_Info(const std::vector<size_t> &matrix_dimensions,
+  Block_Info(const El::mpi::Comm &solver_comm,
+             const std::vector<size_t> &matrix_dimensions,
+             const size_t &procs_per_node, const size_t &proc_granularity,
+             const Verbosity &verbosity);
+  Block_Info(const El::mpi::Comm &solver_comm,
+             const std::vector<size_t> &matrix_dimensions,
+             const std::vector<size_t> &matrix_degrees,
              const size_t &procs_per_node, const size_t &proc_granularity,
              const Verbosity &verbosity);
   void read_block_info(const boost::filesystem::path &sdp_directory);
@@ -101,6 +121,7 @@ namespace std
 
   inline void swap(Block_Info &a, Block_Info &b)
   {
+    swap(a.solver_comm, b.solver_comm);
     swap(a.block_timings_filename, b.block_timings_filename);
     swap(a.file_num_procs, b.file_num_procs);
     swap(a.file_block_indices, b.file_block_indices);
@@ -112,5 +133,8 @@ namespace std
     swap(a.block_indices, b.block_indices);
     swap(a.mpi_group, b.mpi_group);
     swap(a.mpi_comm, b.mpi_comm);
+    swap(a.procs_per_node, b.procs_per_node);
+    swap(a.node_comm, b.node_comm);
+    swap(a.inter_node_comm, b.inter_node_comm);
   }
 }
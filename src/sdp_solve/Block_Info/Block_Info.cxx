@@ -1,10 +1,12 @@
 #include "../Block_Info.hxx"
 
-Block_Info::Block_Info(const boost::filesystem::path &sdp_directory,
+Block_Info::Block_Info(const El::mpi::Comm &solver_comm,
+                       const boost::filesystem::path &sdp_directory,
                        const boost::filesystem::path &checkpoint_in,
                        const size_t &procs_per_node,
                        const size_t &proc_granularity,
                        const Verbosity &verbosity)
+    : solver_comm(solver_comm)
 {
   read_block_info(sdp_directory);
   std::vector<Block_Cost> block_costs(
@@ -12,11 +14,13 @@ Block_Info::Block_Info(const boost::filesystem::path &sdp_directory,
   allocate_blocks(block_costs, procs_per_node, proc_granularity, verbosity);
 }
 
-Block_Info::Block_Info(const boost::filesystem::path &sdp_directory,
+Block_Info::Block_Info(const El::mpi::Comm &solver_comm,
+                       const boost::filesystem::path &sdp_directory,
                        const El::Matrix<int32_t> &block_timings,
                        const size_t &procs_per_node,
                        const size_t &proc_granularity,
                        const Verbosity &verbosity)
+    : solver_comm(solver_comm)
 {
   read_block_info(sdp_directory);
   std::vector<Block_Cost> block_costs;
@@ -27,28 +31,53 @@ Block_Info::Block_Info(const boost::filesystem::path &sdp_directory,
   allocate_blocks(block_costs, procs_per_node, proc_granularity, verbosity);
 }
 
-Block_Info::Block_Info(const std::vector<size_t> &matrix_dimensions,
+Block_Info::Block_Info(const El::mpi::Comm &solver_comm,
+                       const std::vector<size_t> &matrix_dimensions,
+                       const size_t &procs_per_node,
+                       const size_t &proc_granularity,
+                       const Verbosity &verbosity)
+    : Block_Info(solver_comm, matrix_dimensions,
+                 std::vector<size_t>(matrix_dimensions.size(), 0),
+                 procs_per_node, proc_granularity, verbosity)
+{}
+
+// The sizes match the blocks of a Dual_Constraint_Group with the
+// given dimension and degree.  There is no timing information, so the
+// cost is the same estimate as in read_block_costs.
+Block_Info::Block_Info(const El::mpi::Comm &solver_comm,
+                       const std::vector<size_t> &matrix_dimensions,
+                       const std::vector<size_t> &matrix_degrees,
                        const size_t &procs_per_node,
                        const size_t &proc_granularity,
                        const Verbosity &verbosity)
     // TODO: This does not set the filename, file_block_indices, or
     // file_num_procs, since those are only useful when reading in info
     // from a filesystem.
-    : dimensions(matrix_dimensions), degrees(matrix_dimensions.size(), 0),
-      schur_block_sizes(matrix_dimensions.size()),
+    : solver_comm(solver_comm), dimensions(matrix_dimensions),
+      degrees(matrix_degrees), schur_block_sizes(matrix_dimensions.size()),
       psd_matrix_block_sizes(matrix_dimensions.size() * 2),
       bilinear_pairing_block_sizes(matrix_dimensions.size() * 2)
 {
+  if(degrees.size() != dimensions.size())
+    {
+      throw std::runtime_error(
+        "Incompatible number of dimensions and degrees: "
+        + std::to_string(dimensions.size()) + " and "
+        + std::to_string(degrees.size()));
+    }
   for(size_t index(0); index != dimensions.size(); ++index)
     {
+      const size_t &dimension(dimensions.at(index)),
+        &degree(degrees.at(index));
       schur_block_sizes.at(index)
-        = dimensions.at(index) * (dimensions.at(index) + 1) / 2;
-      psd_matrix_block_sizes.at(2 * index) = dimensions.at(index);
-      psd_matrix_block_sizes.at(2 * index + 1) = 0;
+        = dimension * (dimension + 1) / 2 * (degree + 1);
+      psd_matrix_block_sizes.at(2 * index) = (degree / 2 + 1) * dimension;
+      psd_matrix_block_sizes.at(2 * index + 1)
+        = ((degree + 1) / 2) * dimension;
 
       bilinear_pairing_block_sizes.at(2 * index)
         = bilinear_pairing_block_sizes.at(2 * index + 1)
-        = dimensions.at(index);
+        = (degree + 1) * dimension;
     }
 
   std::vector<Block_Cost> block_costs;
@@ -15,7 +15,7 @@ void Block_Info::allocate_blocks(const std::vector<Block_Cost> &block_costs,
   // Reverse sort, with largest first
   std::vector<Block_Cost> sorted_costs(block_costs);
   std::sort(sorted_costs.rbegin(), sorted_costs.rend());
-  const size_t num_procs(El::mpi::Size(El::mpi::COMM_WORLD));
+  const size_t num_procs(El::mpi::Size(solver_comm));
   if(num_procs % procs_per_node != 0)
     {
       throw std::runtime_error(
@@ -45,9 +45,9 @@ void Block_Info::allocate_blocks(const std::vector<Block_Cost> &block_costs,
 
   // Create an mpi::Group for each set of processors.
   El::mpi::Group default_mpi_group;
-  El::mpi::CommGroup(El::mpi::COMM_WORLD, default_mpi_group);
+  El::mpi::CommGroup(solver_comm, default_mpi_group);
 
-  int rank(El::mpi::Rank(El::mpi::COMM_WORLD));
+  int rank(El::mpi::Rank(solver_comm));
 
   if(verbosity >= Verbosity::regular && rank == 0)
     {
@@ -113,5 +113,11 @@ void Block_Info::allocate_blocks(const std::vector<Block_Cost> &block_costs,
     El::mpi::Incl(default_mpi_group, group_ranks.size(), group_ranks.data(),
                   mpi_group.value);
   }
-  El::mpi::Create(El::mpi::COMM_WORLD, mpi_group.value, mpi_comm.value);
+  El::mpi::Create(solver_comm, mpi_group.value, mpi_comm.value);
+
+  this->procs_per_node = procs_per_node;
+  El::mpi::Split(solver_comm, rank / procs_per_node, rank,
+                 node_comm.value);
+  El::mpi::Split(solver_comm, rank % procs_per_node, rank,
+                 inter_node_comm.value);
 }
@@ -10,7 +10,8 @@ Block_Info::read_block_costs(const boost::filesystem::path &sdp_directory,
                                                        / "block_timings"),
     checkpoint_block_timings_path(checkpoint_in / "block_timings");
 
-  if(exists(checkpoint_in / ("checkpoint." + std::to_string(El::mpi::Rank()))))
+  if(exists(checkpoint_in
+            / ("checkpoint." + std::to_string(El::mpi::Rank(solver_comm)))))
     {
       if(exists(checkpoint_block_timings_path))
         {
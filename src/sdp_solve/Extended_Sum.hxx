@@ -0,0 +1,77 @@
+#pragma once
+
+#include <El.hpp>
+
+// A running sum of BigFloats and BigFloat products, kept with about
+// twice the working precision.
+//
+// Products of two BigFloats fit in the extra precision, so products
+// are not rounded, and the additions are only rounded at the level of
+// the extended precision rather than the working precision.  This
+// keeps the large cancellations in Tr(XY) and the objectives from
+// eating into the digits of mu and the duality gap.
+//
+// To combine sums across processes, a sum is split into two
+// BigFloats, high + low, which together carry the extended precision.
+struct Extended_Sum
+{
+  mpf_class sum, scratch, scratch_sum;
+
+  Extended_Sum()
+      : sum(0, extended_precision()), scratch(0, extended_precision()),
+        scratch_sum(0, extended_precision())
+  {}
+
+  static mp_bitcnt_t extended_precision()
+  {
+    return 2 * mpf_get_default_prec() + 64;
+  }
+
+  void add(const El::BigFloat &a)
+  {
+    mpf_add(sum.get_mpf_t(), sum.get_mpf_t(), a.gmp_float.get_mpf_t());
+  }
+
+  void add(const Extended_Sum &a)
+  {
+    mpf_add(sum.get_mpf_t(), sum.get_mpf_t(), a.sum.get_mpf_t());
+  }
+
+  // sum += a b
+  void add_product(const El::BigFloat &a, const El::BigFloat &b)
+  {
+    mpf_mul(scratch.get_mpf_t(), a.gmp_float.get_mpf_t(),
+            b.gmp_float.get_mpf_t());
+    mpf_add(sum.get_mpf_t(), sum.get_mpf_t(), scratch.get_mpf_t());
+  }
+
+  // sum += (a + da) (b + db)
+  void add_product_of_sums(const El::BigFloat &a, const El::BigFloat &da,
+                           const El::BigFloat &b, const El::BigFloat &db)
+  {
+    mpf_add(scratch.get_mpf_t(), a.gmp_float.get_mpf_t(),
+            da.gmp_float.get_mpf_t());
+    mpf_add(scratch_sum.get_mpf_t(), b.gmp_float.get_mpf_t(),
+            db.gmp_float.get_mpf_t());
+    mpf_mul(scratch.get_mpf_t(), scratch.get_mpf_t(),
+            scratch_sum.get_mpf_t());
+    mpf_add(sum.get_mpf_t(), sum.get_mpf_t(), scratch.get_mpf_t());
+  }
+
+  // sum = high + low, to the extended precision
+  void split(El::BigFloat &high, El::BigFloat &low)
+  {
+    mpf_set(high.gmp_float.get_mpf_t(), sum.get_mpf_t());
+    mpf_sub(scratch.get_mpf_t(), sum.get_mpf_t(),
+            high.gmp_float.get_mpf_t());
+    mpf_set(low.gmp_float.get_mpf_t(), scratch.get_mpf_t());
+  }
+
+  // The sum rounded to the working precision
+  El::BigFloat value() const
+  {
+    El::BigFloat result;
+    mpf_set(result.gmp_float.get_mpf_t(), sum.get_mpf_t());
+    return result;
+  }
+};
@@ -14,6 +14,8 @@
 
 #include <boost/filesystem.hpp>
 
+class Dual_Constraint_Group;
+
 // The class SDP encodes a semidefinite program of the following form
 //
 // Dual: maximize f + b.y over y,Y such that
@@ -83,8 +85,16 @@ struct SDP
   std::vector<El::Matrix<El::BigFloat>> bilinear_bases_local;
   std::vector<El::DistMatrix<El::BigFloat>> bilinear_bases_dist;
 
-  // free_var_matrix = B, a PxN matrix
+  // free_var_matrix = B, a PxN matrix.  Many blocks of B only have a
+  // few nonzero columns, so each block only stores the range of
+  // columns that contain nonzeros.  Block b holds columns
+  //
+  //   [free_var_column_offsets[b],
+  //    free_var_column_offsets[b] + free_var_matrix.blocks[b].Width())
+  //
+  // of B, and every other column of that block is zero.
   Block_Matrix free_var_matrix;
+  std::vector<int64_t> free_var_column_offsets;
 
   // c, a vector of length P used with primal_objective
   Block_Vector primal_objective_c;
@@ -105,4 +115,9 @@ struct SDP
       const std::vector<std::vector<El::BigFloat>> &primal_objective_c_input,
       const std::vector<El::Matrix<El::BigFloat>> &free_var_input,
       const Block_Info &block_info, const El::Grid &grid);
+  // dual_constraint_groups[i] is the block block_info.block_indices[i]
+  SDP(const El::BigFloat &objective_const,
+      const std::vector<El::BigFloat> &dual_objective_b_input,
+      const std::vector<Dual_Constraint_Group> &dual_constraint_groups,
+      const Block_Info &block_info, const El::Grid &grid);
 };
@@ -1,11 +1,12 @@
 #include "assign_bilinear_bases_dist.hxx"
 #include "set_dual_objective_b.hxx"
 #include "../../SDP.hxx"
+#include "../../../sdp_convert/Dual_Constraint_Group.hxx"
 
 #include <boost/filesystem.hpp>
 
 void read_blocks(const boost::filesystem::path &sdp_directory, SDP &sdp);
-void read_objectives(const boost::filesystem::path &sdp_directory,
+void read_objectives(const boost::filesystem::path &objectives_path,
                      const El::Grid &grid, El::BigFloat &objective_const,
                      El::DistMatrix<El::BigFloat> &dual_objective_b);
 void read_bilinear_bases(
@@ -20,18 +21,20 @@ void read_primal_objective_c(const boost::filesystem::path &sdp_directory,
                              Block_Vector &primal_objective_c);
 void read_free_var_matrix(const boost::filesystem::path &sdp_directory,
                           const std::vector<size_t> &block_indices,
-                          const El::Grid &grid, Block_Matrix &free_var_matrix);
+                          const El::Grid &grid, Block_Matrix &free_var_matrix,
+                          std::vector<int64_t> &free_var_column_offsets);
 
 SDP::SDP(const boost::filesystem::path &sdp_directory,
          const Block_Info &block_info, const El::Grid &grid)
 {
-  read_objectives(sdp_directory, grid, objective_const, dual_objective_b);
+  read_objectives(sdp_directory / "objectives", grid, objective_const,
+                  dual_objective_b);
   read_bilinear_bases(sdp_directory, block_info, grid, bilinear_bases_local,
                       bilinear_bases_dist);
   read_primal_objective_c(sdp_directory, block_info.block_indices, grid,
                           primal_objective_c);
   read_free_var_matrix(sdp_directory, block_info.block_indices, grid,
-                       free_var_matrix);
+                       free_var_matrix, free_var_column_offsets);
 }
 
 SDP::SDP(const El::BigFloat &objective_const_input,
@@ -128,7 +131,9 @@ SDP::SDP(const El::BigFloat &objective_const_input,
   El::Gemv(El::Orientation::TRANSPOSE, El::BigFloat(1.0), yp_to_y, b_new,
            El::BigFloat(0.0), dual_objective_b);
 
+  // U is dense, so store every column.
   free_var_matrix.blocks.reserve(block_indices.size());
+  free_var_column_offsets.assign(block_indices.size(), 0);
   int64_t global_row(0);
   for(size_t block(0); block != block_indices.size(); ++block)
     {
@@ -151,3 +156,98 @@ SDP::SDP(const El::BigFloat &objective_const_input,
         }
     }
 }
+
+// Build the SDP directly from the Dual_Constraint_Groups of the local
+// blocks, without writing them out and reading them back in.  Unlike
+// the constructor above, the bilinear bases can be any size, and y is
+// not rotated, so yp_to_y is the identity.
+SDP::SDP(const El::BigFloat &objective_const_input,
+         const std::vector<El::BigFloat> &dual_objective_b_input,
+         const std::vector<Dual_Constraint_Group> &dual_constraint_groups,
+         const Block_Info &block_info, const El::Grid &grid)
+    : yp_to_y(grid), objective_const(objective_const_input)
+{
+  auto &block_indices(block_info.block_indices);
+  if(dual_constraint_groups.size() != block_indices.size())
+    {
+      throw std::runtime_error(
+        "Incompatible number of Dual_Constraint_Groups.  Expected "
+        + std::to_string(block_indices.size()) + " but found "
+        + std::to_string(dual_constraint_groups.size()));
+    }
+
+  set_dual_objective_b(dual_objective_b_input, grid, dual_objective_b);
+  const int64_t dual_objective_b_height(dual_objective_b_input.size());
+  El::Identity(yp_to_y, dual_objective_b_height, dual_objective_b_height);
+
+  bilinear_bases_local.reserve(2 * block_indices.size());
+  primal_objective_c.blocks.reserve(block_indices.size());
+  free_var_matrix.blocks.reserve(block_indices.size());
+  free_var_column_offsets.reserve(block_indices.size());
+  const El::BigFloat zero(0);
+  for(size_t block(0); block != block_indices.size(); ++block)
+    {
+      const Dual_Constraint_Group &group(dual_constraint_groups[block]);
+      const El::Matrix<El::BigFloat> &constraint_matrix(
+        group.constraint_matrix);
+      if(constraint_matrix.Width() != dual_objective_b_height)
+        {
+          throw std::runtime_error(
+            "Incompatible Dual_Constraint_Group for block "
+            + std::to_string(block_indices[block]) + ".  Expected "
+            + std::to_string(dual_objective_b_height)
+            + " columns in the constraint matrix but found "
+            + std::to_string(constraint_matrix.Width()));
+        }
+
+      for(auto &bilinear_basis : group.bilinear_bases)
+        {
+          bilinear_bases_local.push_back(bilinear_basis);
+        }
+
+      primal_objective_c.blocks.emplace_back(
+        group.constraint_constants.size(), 1, grid);
+      auto &primal_block(primal_objective_c.blocks.back());
+      if(primal_block.GlobalCol(0) == 0)
+        {
+          for(int64_t row = 0; row < primal_block.LocalHeight(); ++row)
+            {
+              primal_block.SetLocal(
+                row, 0,
+                group.constraint_constants.at(primal_block.GlobalRow(row)));
+            }
+        }
+
+      // Only keep the range of columns with nonzeros, as in
+      // read_free_var_matrix.
+      int64_t column_begin(constraint_matrix.Width()), column_end(0);
+      for(int64_t row = 0; row < constraint_matrix.Height(); ++row)
+        for(int64_t column = 0; column < constraint_matrix.Width(); ++column)
+          {
+            if(constraint_matrix(row, column) != zero)
+              {
+                column_begin = std::min(column_begin, column);
+                column_end = std::max(column_end, column + 1);
+              }
+          }
+      if(column_end == 0)
+        {
+          column_begin = 0;
+        }
+      free_var_column_offsets.push_back(column_begin);
+      free_var_matrix.blocks.emplace_back(constraint_matrix.Height(),
+                                          column_end - column_begin, grid);
+      auto &free_var_block(free_var_matrix.blocks.back());
+      for(int64_t row = 0; row < free_var_block.LocalHeight(); ++row)
+        for(int64_t column = 0; column < free_var_block.LocalWidth();
+            ++column)
+          {
+            free_var_block.SetLocal(
+              row, column,
+              constraint_matrix(free_var_block.GlobalRow(row),
+                                column_begin
+                                  + free_var_block.GlobalCol(column)));
+          }
+    }
+  assign_bilinear_bases_dist(bilinear_bases_local, grid, bilinear_bases_dist);
+}
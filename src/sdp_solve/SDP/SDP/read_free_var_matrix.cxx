@@ -3,46 +3,127 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
 
+#include <vector>
+
+// Each block is read once.  For every row that this process owns, we
+// buffer the values between its first and last nonzero, while keeping
+// track of the range of columns that contain nonzeros in those rows.
+// The ranges are combined over the grid, and only that range of
+// columns is stored in the block, so the zero columns are never held
+// in memory.
+//
+// Which rows a process owns only depends on the grid, not on the width
+// of the block, so the rows can be picked out before the block is
+// allocated.  Each process only buffers its own rows.
+
+namespace
+{
+  void read_header(const boost::filesystem::path &free_var_matrix_path,
+                   boost::filesystem::ifstream &free_var_matrix_stream,
+                   size_t &height, size_t &width)
+  {
+    if(!free_var_matrix_stream.good())
+      {
+        throw std::runtime_error("Could not open '"
+                                 + free_var_matrix_path.string() + "'");
+      }
+    free_var_matrix_stream >> height >> width;
+    if(!free_var_matrix_stream.good())
+      {
+        throw std::runtime_error("Corrupted header in file: "
+                                 + free_var_matrix_path.string());
+      }
+  }
+}
+
 void read_free_var_matrix(const boost::filesystem::path &sdp_directory,
                           const std::vector<size_t> &block_indices,
-                          const El::Grid &grid, Block_Matrix &free_var_matrix)
+                          const El::Grid &grid, Block_Matrix &free_var_matrix,
+                          std::vector<int64_t> &free_var_column_offsets)
 {
   free_var_matrix.blocks.reserve(block_indices.size());
+  free_var_column_offsets.reserve(block_indices.size());
+  const El::BigFloat zero(0);
   for(auto &block_index : block_indices)
     {
       const boost::filesystem::path free_var_matrix_path(
         sdp_directory / ("free_var_matrix." + std::to_string(block_index)));
+
       boost::filesystem::ifstream free_var_matrix_stream(free_var_matrix_path);
-      if(!free_var_matrix_stream.good())
+      size_t height, width;
+      read_header(free_var_matrix_path, free_var_matrix_stream, height,
+                  width);
+
+      // The block is [MC,MR] distributed with no alignment, so this
+      // process owns every row_stride'th row, starting at row_shift.
+      const size_t row_shift(grid.Row()), row_stride(grid.Height()),
+        local_height(height > row_shift
+                       ? (height - row_shift + row_stride - 1) / row_stride
+                       : 0);
+
+      // row_begins[local_row] is the column of row_values[local_row][0]
+      std::vector<size_t> row_begins(local_height, 0);
+      std::vector<std::vector<El::BigFloat>> row_values(local_height);
+      int64_t column_begin(width), column_end(0);
+      std::vector<El::BigFloat> row_buffer(width);
+      for(size_t row = 0; row < height; ++row)
         {
-          throw std::runtime_error("Could not open '"
-                                   + free_var_matrix_path.string() + "'");
+          size_t row_begin(width), row_end(0);
+          for(size_t column = 0; column < width; ++column)
+            {
+              free_var_matrix_stream >> row_buffer[column];
+              if(row_buffer[column] != zero)
+                {
+                  row_begin = std::min(row_begin, column);
+                  row_end = column + 1;
+                }
+            }
+          if(row_begin < row_end && row % row_stride == row_shift)
+            {
+              const size_t local_row((row - row_shift) / row_stride);
+              row_begins[local_row] = row_begin;
+              row_values[local_row].assign(row_buffer.begin() + row_begin,
+                                           row_buffer.begin() + row_end);
+              column_begin = std::min(column_begin, int64_t(row_begin));
+              column_end = std::max(column_end, int64_t(row_end));
+            }
         }
-
-      size_t height, width;
-      free_var_matrix_stream >> height >> width;
       if(!free_var_matrix_stream.good())
         {
-          throw std::runtime_error("Corrupted header in file: "
+          throw std::runtime_error("Corrupted data in file: "
                                    + free_var_matrix_path.string());
         }
-      free_var_matrix.blocks.emplace_back(height, width, grid);
+
+      // The range of columns of the block covers the rows of every
+      // process in the grid.
+      column_begin
+        = El::mpi::AllReduce(column_begin, El::mpi::MIN, grid.Comm());
+      column_end = El::mpi::AllReduce(column_end, El::mpi::MAX, grid.Comm());
+      if(column_end == 0)
+        {
+          column_begin = 0;
+        }
+
+      free_var_column_offsets.push_back(column_begin);
+      free_var_matrix.blocks.emplace_back(height, column_end - column_begin,
+                                          grid);
       auto &block(free_var_matrix.blocks.back());
-      for(size_t row = 0; row < height; ++row)
-        for(size_t column = 0; column < width; ++column)
-          {
-            El::BigFloat input_num;
-            free_var_matrix_stream >> input_num;
-            if(block.IsLocal(row, column))
-              {
-                block.SetLocal(block.LocalRow(row), block.LocalCol(column),
-                               input_num);
-              }
-          }
-      if(!free_var_matrix_stream.good())
+      El::Zero(block);
+      for(int64_t local_row = 0; local_row < block.LocalHeight(); ++local_row)
         {
-          throw std::runtime_error("Corrupted data in file: "
-                                   + free_var_matrix_path.string());
+          const std::vector<El::BigFloat> &values(row_values[local_row]);
+          const size_t row_begin(row_begins[local_row]);
+          for(int64_t local_column = 0; local_column < block.LocalWidth();
+              ++local_column)
+            {
+              const size_t column(block.GlobalCol(local_column)
+                                  + column_begin);
+              if(column >= row_begin && column < row_begin + values.size())
+                {
+                  block.SetLocal(local_row, local_column,
+                                 values[column - row_begin]);
+                }
+            }
         }
     }
 }
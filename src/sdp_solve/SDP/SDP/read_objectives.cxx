@@ -5,11 +5,10 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
 
-void read_objectives(const boost::filesystem::path &sdp_directory,
+void read_objectives(const boost::filesystem::path &objectives_path,
                      const El::Grid &grid, El::BigFloat &objective_const,
                      El::DistMatrix<El::BigFloat> &dual_objective_b)
 {
-  const boost::filesystem::path objectives_path(sdp_directory / "objectives");
   boost::filesystem::ifstream objectives_stream(objectives_path);
   if(!objectives_stream.good())
     {
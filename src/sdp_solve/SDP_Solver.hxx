@@ -87,24 +87,27 @@ public:
   step(const SDP_Solver_Parameters &parameters,
        const std::size_t &total_psd_rows,
        const bool &is_primal_and_dual_feasible, const Block_Info &block_info,
-       const SDP &sdp, const El::Grid &grid,
+       const SDP &sdp, const El::Grid &grid, const El::Grid &Q_grid,
        const Block_Diagonal_Matrix &X_cholesky,
        const Block_Diagonal_Matrix &Y_cholesky,
        const Block_Diagonal_Matrix &bilinear_pairings_X_inv,
        const Block_Diagonal_Matrix &bilinear_pairings_Y,
-       const Block_Vector &primal_residue_p, El::BigFloat &mu,
+       const Block_Vector &primal_residue_p, const El::BigFloat &mu,
        El::BigFloat &beta_corrector, El::BigFloat &primal_step_length,
-       El::BigFloat &dual_step_length, bool &terminate_now, Timers &timers);
+       El::BigFloat &dual_step_length, Timers &timers);
 
   void save_solution(const SDP_Solver_Terminate_Reason,
                      const std::pair<std::string, Timer> &timer_pair,
                      const boost::filesystem::path &out_directory,
                      const Write_Solution &write_solution,
-                     const std::vector<size_t> &block_indices,
+                     const Block_Info &block_info,
                      const Verbosity &verbosity) const;
-  void save_checkpoint(const SDP_Solver_Parameters &parameters);
+  void save_checkpoint(const SDP_Solver_Parameters &parameters,
+                       const Block_Info &block_info);
   bool
   load_checkpoint(const boost::filesystem::path &checkpoint_directory,
                   const Block_Info &block_info, const Verbosity &verbosity,
                   const bool &require_initial_checkpoint);
+  bool load_warm_start(const SDP_Solver_Parameters &parameters,
+                       const Block_Info &block_info);
 };
@@ -1,5 +1,9 @@
 #include "../SDP_Solver.hxx"
 
+void recenter_warm_start(const El::BigFloat &target_mu,
+                         const Block_Info &block_info,
+                         Block_Diagonal_Matrix &X, Block_Diagonal_Matrix &Y);
+
 SDP_Solver::SDP_Solver(const SDP_Solver_Parameters &parameters,
                        const Block_Info &block_info, const El::Grid &grid,
                        const size_t &dual_objective_b_height)
@@ -15,9 +19,19 @@ SDP_Solver::SDP_Solver(const SDP_Solver_Parameters &parameters,
                     block_info.schur_block_sizes.size(), grid),
       current_generation(0)
 {
-  if(!load_checkpoint(parameters.checkpoint_in, block_info,
-                      parameters.verbosity,
-                      parameters.require_initial_checkpoint))
+  if(load_checkpoint(parameters.checkpoint_in, block_info,
+                     parameters.verbosity,
+                     parameters.require_initial_checkpoint))
+    {
+      return;
+    }
+
+  if(!parameters.warm_start_dir.empty()
+     && load_warm_start(parameters, block_info))
+    {
+      recenter_warm_start(parameters.warm_start_mu, block_info, X, Y);
+    }
+  else
     {
       X.set_zero();
       Y.set_zero();
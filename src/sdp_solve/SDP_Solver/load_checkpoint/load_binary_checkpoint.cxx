@@ -1,77 +1,15 @@
 #include "../../SDP_Solver.hxx"
+#include "read_local_binary_blocks.hxx"
 
 #include <boost/filesystem.hpp>
-#include <boost/filesystem/fstream.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
-template <typename T>
-void read_local_binary_blocks(T &t,
-                              boost::filesystem::ifstream &checkpoint_stream)
-{
-  El::BigFloat zero(0);
-  const size_t serialized_size(zero.SerializedSize());
-  std::vector<uint8_t> local_array(serialized_size);
-
-  for(auto &block : t.blocks)
-    {
-      int64_t local_height, local_width;
-      checkpoint_stream.read(reinterpret_cast<char *>(&local_height),
-                             sizeof(int64_t));
-      checkpoint_stream.read(reinterpret_cast<char *>(&local_width),
-                             sizeof(int64_t));
-
-      if(!checkpoint_stream.good())
-        {
-          std::stringstream ss;
-          ss << "Corrupted binary checkpoint file.  For block with "
-             << "global size (" << block.Height() << "," << block.Width()
-             << ") and local dimensions (" << block.LocalHeight() << ","
-             << block.LocalWidth() << "), error when reading height and width";
-          throw std::runtime_error(ss.str());
-        }
-
-      if(local_height != block.LocalHeight()
-         || local_width != block.LocalWidth())
-        {
-          std::stringstream ss;
-          ss << "Incompatible binary checkpoint file.  For block with "
-             << "global size (" << block.Height() << "," << block.Width()
-             << "), expected local dimensions (" << block.LocalHeight() << ","
-             << block.LocalWidth() << "), but found (" << local_height << ","
-             << local_width << ")";
-
-          throw std::runtime_error(ss.str());
-        }
-
-      for(int64_t row = 0; row < local_height; ++row)
-        for(int64_t column = 0; column < local_width; ++column)
-          {
-            El::BigFloat input;
-            checkpoint_stream.read(
-              reinterpret_cast<char *>(local_array.data()),
-              std::streamsize(local_array.size()));
-            if(!checkpoint_stream.good())
-              {
-                std::stringstream ss;
-                ss << "Corrupted binary checkpoint file.  For block with "
-                   << "global size (" << block.Height() << "," << block.Width()
-                   << ") and local dimensions (" << block.LocalHeight() << ","
-                   << block.LocalWidth() << "), error when reading element ("
-                   << row << "," << column << ")";
-                throw std::runtime_error(ss.str());
-              }
-            input.Deserialize(local_array.data());
-
-            block.SetLocal(row, column, input);
-          }
-    }
-}
-
 bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
+                            const El::mpi::Comm &comm,
                             const Verbosity &verbosity, SDP_Solver &solver)
 {
   int64_t current_generation(-1), backup_generation(-1);
-  if(El::mpi::Rank() == 0)
+  if(El::mpi::Rank(comm) == 0)
     {
       boost::filesystem::path metadata(checkpoint_directory
                                        / "checkpoint.json");
@@ -105,7 +43,7 @@ bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
   // the Broadcast() with int32_t instead of int64_t?
   El::mpi::Broadcast(reinterpret_cast<El::byte *>(&current_generation),
                      sizeof(current_generation) / sizeof(El::byte), 0,
-                     El::mpi::COMM_WORLD);
+                     comm);
   boost::filesystem::path checkpoint_filename;
   if(current_generation != -1)
     {
@@ -113,7 +51,7 @@ bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
       checkpoint_filename
         = checkpoint_directory
           / ("checkpoint_" + std::to_string(current_generation) + "_"
-             + std::to_string(El::mpi::Rank()));
+             + std::to_string(El::mpi::Rank(comm)));
       if(!exists(checkpoint_filename))
         {
           throw std::runtime_error("Missing checkpoint file: "
@@ -122,13 +60,13 @@ bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
       // See note above about Broadcast()
       El::mpi::Broadcast(reinterpret_cast<El::byte *>(&backup_generation),
                          sizeof(current_generation) / sizeof(El::byte), 0,
-                         El::mpi::COMM_WORLD);
+                         comm);
     }
   else
     {
       checkpoint_filename
         = checkpoint_directory
-          / ("checkpoint." + std::to_string(El::mpi::Rank()));
+          / ("checkpoint." + std::to_string(El::mpi::Rank(comm)));
       if(!exists(checkpoint_filename))
         {
           return false;
@@ -137,7 +75,7 @@ bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
     }
 
   boost::filesystem::ifstream checkpoint_stream(checkpoint_filename);
-  if(verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
+  if(verbosity >= Verbosity::regular && El::mpi::Rank(comm) == 0)
     {
       std::cout << "Loading binary checkpoint from : " << checkpoint_directory
                 << '\n';
@@ -1,10 +1,12 @@
 #include "../../SDP_Solver.hxx"
 
 bool load_binary_checkpoint(const boost::filesystem::path &checkpoint_directory,
+                            const El::mpi::Comm &comm,
                             const Verbosity &verbosity, SDP_Solver &solver);
 
 bool load_text_checkpoint(const boost::filesystem::path &checkpoint_directory,
                           const std::vector<size_t> &block_indices,
+                          const El::mpi::Comm &comm,
                           const Verbosity &verbosity, SDP_Solver &solver);
 
 bool SDP_Solver::load_checkpoint(
@@ -13,9 +15,10 @@ bool SDP_Solver::load_checkpoint(
   const bool &require_initial_checkpoint)
 {
   bool valid_checkpoint(
-    load_binary_checkpoint(checkpoint_directory, verbosity, *this)
+    load_binary_checkpoint(checkpoint_directory, block_info.solver_comm,
+                           verbosity, *this)
     || load_text_checkpoint(checkpoint_directory, block_info.block_indices,
-                            verbosity, *this));
+                            block_info.solver_comm, verbosity, *this));
   if(!valid_checkpoint && require_initial_checkpoint)
     {
       throw std::runtime_error("Unable to load checkpoint from directory: "
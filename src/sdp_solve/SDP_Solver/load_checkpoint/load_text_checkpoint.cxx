@@ -57,6 +57,7 @@ void read_text_block(El::DistMatrix<El::BigFloat> &block,
 
 bool load_text_checkpoint(const boost::filesystem::path &checkpoint_directory,
                           const std::vector<size_t> &block_indices,
+                          const El::mpi::Comm &comm,
                           const Verbosity &verbosity, SDP_Solver &solver)
 {
   if(!exists(checkpoint_directory / "x_0.txt"))
@@ -64,7 +65,7 @@ bool load_text_checkpoint(const boost::filesystem::path &checkpoint_directory,
       return false;
     }
 
-  if(verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
+  if(verbosity >= Verbosity::regular && El::mpi::Rank(comm) == 0)
     {
       std::cout << "Loading text checkpoint from : " << checkpoint_directory
                 << '\n';
@@ -0,0 +1,94 @@
+#include "../../SDP_Solver.hxx"
+#include "../load_checkpoint/read_local_binary_blocks.hxx"
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+// Load x, X, y and Y from the binary checkpoint of a related SDP.
+// Unlike load_checkpoint, this never throws on a bad checkpoint.  All
+// processes agree on whether the load succeeded, so that a checkpoint
+// with a different block structure (or from a different number of
+// processes) is rejected everywhere, and the caller falls back to the
+// usual initial point.  The generation counters are left alone, so
+// the warm start is never mistaken for this SDP's own checkpoint.
+
+bool SDP_Solver::load_warm_start(const SDP_Solver_Parameters &parameters,
+                                 const Block_Info &block_info)
+{
+  const El::mpi::Comm &comm(block_info.solver_comm);
+  const boost::filesystem::path &warm_start_dir(parameters.warm_start_dir);
+  int64_t generation(-1);
+  if(El::mpi::Rank(comm) == 0)
+    {
+      const boost::filesystem::path metadata(warm_start_dir
+                                             / "checkpoint.json");
+      try
+        {
+          if(exists(metadata))
+            {
+              boost::property_tree::ptree tree;
+              boost::property_tree::read_json(metadata.string(), tree);
+              generation = tree.get<int64_t>("current", -1);
+            }
+        }
+      catch(std::exception &e)
+        {
+          std::cout << "Unable to read " << metadata << ": " << e.what()
+                    << '\n';
+        }
+    }
+  // See the note in load_binary_checkpoint about Broadcast()
+  El::mpi::Broadcast(reinterpret_cast<El::byte *>(&generation),
+                     sizeof(generation) / sizeof(El::byte), 0, comm);
+
+  const std::string rank(std::to_string(El::mpi::Rank(comm)));
+  const boost::filesystem::path checkpoint_filename(
+    warm_start_dir
+    / (generation != -1
+         ? ("checkpoint_" + std::to_string(generation) + "_" + rank)
+         : ("checkpoint." + rank)));
+
+  std::string error;
+  try
+    {
+      boost::filesystem::ifstream checkpoint_stream(checkpoint_filename);
+      if(!checkpoint_stream.good())
+        {
+          throw std::runtime_error("Unable to open "
+                                   + checkpoint_filename.string());
+        }
+      read_local_binary_blocks(x, checkpoint_stream);
+      read_local_binary_blocks(X, checkpoint_stream);
+      read_local_binary_blocks(y, checkpoint_stream);
+      read_local_binary_blocks(Y, checkpoint_stream);
+      // Any data left over means the checkpoint has more blocks than
+      // this SDP.
+      if(checkpoint_stream.peek() != std::char_traits<char>::eof())
+        {
+          throw std::runtime_error(
+            "Incompatible binary checkpoint file.  Found extra data at the "
+            "end of "
+            + checkpoint_filename.string());
+        }
+    }
+  catch(std::exception &e)
+    {
+      error = e.what();
+    }
+
+  const int loaded(El::mpi::AllReduce(static_cast<int>(error.empty()),
+                                      El::mpi::MIN, comm));
+  if(!error.empty())
+    {
+      std::cout << "Rank " << rank
+                << ": unable to load warm start: " << error << '\n'
+                << std::flush;
+    }
+  if(El::mpi::Rank(comm) == 0 && parameters.verbosity >= Verbosity::regular)
+    {
+      std::cout << (loaded != 0 ? "Warm starting from      : "
+                                : "Ignoring warm start from: ")
+                << warm_start_dir << '\n';
+    }
+  return loaded != 0;
+}
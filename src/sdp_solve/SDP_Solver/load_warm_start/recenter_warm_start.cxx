@@ -0,0 +1,87 @@
+#include "../../Block_Diagonal_Matrix.hxx"
+#include "../../Block_Info.hxx"
+
+#include <numeric>
+
+Extended_Sum local_frobenius_product_symmetric(const Block_Diagonal_Matrix &A,
+                                               const Block_Diagonal_Matrix &B);
+
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins);
+
+// A point loaded from a neighboring SDP's checkpoint is usually close
+// to that SDP's optimum, so X and Y are nearly singular and mu is
+// tiny.  Starting there, the new SDP's residues force very short
+// steps.  Instead, shift X and Y toward the interior,
+//
+//   X -> X + t Tr(X)/n I,   Y -> Y + t Tr(Y)/n I,
+//
+// where n = dim(X).  With K = Tr(X) Tr(Y)/n, the complementarity
+// becomes
+//
+//   Tr(X Y) + K (2 t + t^2),
+//
+// so t is chosen to bring mu = Tr(X Y)/n up to target_mu.  The shift
+// keeps the relative scales of X and Y from the old solution.  If mu
+// is already larger than target_mu, nothing changes.
+
+namespace
+{
+  void add_local_trace(const Block_Diagonal_Matrix &A, Extended_Sum &trace)
+  {
+    for(auto &block : A.blocks)
+      {
+        const El::Matrix<El::BigFloat> &local(block.LockedMatrix());
+        for(int64_t row = 0; row < block.LocalHeight(); ++row)
+          {
+            const int64_t global_row(block.GlobalRow(row));
+            if(block.IsLocalCol(global_row))
+              {
+                trace.add(local(row, block.LocalCol(global_row)));
+              }
+          }
+      }
+  }
+}
+
+void recenter_warm_start(const El::BigFloat &target_mu,
+                         const Block_Info &block_info,
+                         Block_Diagonal_Matrix &X, Block_Diagonal_Matrix &Y)
+{
+  const El::BigFloat n(
+    std::accumulate(block_info.psd_matrix_block_sizes.begin(),
+                    block_info.psd_matrix_block_sizes.end(), size_t(0)));
+
+  std::vector<Extended_Sum> sums(3);
+  add_local_trace(X, sums[0]);
+  add_local_trace(Y, sums[1]);
+  sums[2] = local_frobenius_product_symmetric(X, Y);
+  std::vector<El::BigFloat> maxes, mins;
+  fused_all_reduce(block_info.solver_comm, sums, maxes, mins);
+
+  const El::BigFloat trace_X(sums[0].value()), trace_Y(sums[1].value()),
+    trace_XY(sums[2].value()), deficit(n * target_mu - trace_XY),
+    zero(0);
+  if(deficit <= zero)
+    {
+      return;
+    }
+
+  if(trace_X > zero && trace_Y > zero)
+    {
+      const El::BigFloat K(trace_X * trace_Y / n),
+        t(El::Sqrt(El::BigFloat(1) + deficit / K) - El::BigFloat(1));
+      X.add_diagonal(t * trace_X / n);
+      Y.add_diagonal(t * trace_Y / n);
+    }
+  else
+    {
+      // A degenerate checkpoint: fall back to a multiple of the
+      // identity with the target complementarity.
+      const El::BigFloat shift(El::Sqrt(target_mu));
+      X.add_diagonal(shift);
+      Y.add_diagonal(shift);
+    }
+}
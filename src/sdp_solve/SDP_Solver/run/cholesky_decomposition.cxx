@@ -1,13 +1,17 @@
 #include "../../Block_Diagonal_Matrix.hxx"
 
+void cholesky_lower(const size_t &replicated_factor_threshold,
+                    El::DistMatrix<El::BigFloat> &A);
+
 // Compute L (lower triangular) such that A = L L^T
-void cholesky_decomposition(const Block_Diagonal_Matrix &A,
+void cholesky_decomposition(const size_t &replicated_factor_threshold,
+                            const Block_Diagonal_Matrix &A,
                             Block_Diagonal_Matrix &L)
 {
   for(size_t b = 0; b < A.blocks.size(); b++)
     {
       // FIXME: Use pivoting?
       L.blocks[b] = A.blocks[b];
-      Cholesky(El::UpperOrLowerNS::LOWER, L.blocks[b]);
+      cholesky_lower(replicated_factor_threshold, L.blocks[b]);
     }
 }
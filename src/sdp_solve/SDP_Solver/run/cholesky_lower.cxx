@@ -0,0 +1,27 @@
+#include <El.hpp>
+
+// A := L, where A = L L^T and L is lower triangular.
+//
+// If A is split across more than one process and has at most
+// replicated_factor_threshold rows, every process in A's grid gathers
+// all of A and factors it locally.  This replaces the many small
+// messages of the distributed algorithm with a single AllGather.
+// Copying the factor back out of the replicated matrix is local.
+
+bool use_replicated_factor(const size_t &replicated_factor_threshold,
+                           const El::DistMatrix<El::BigFloat> &A);
+
+void cholesky_lower(const size_t &replicated_factor_threshold,
+                    El::DistMatrix<El::BigFloat> &A)
+{
+  if(use_replicated_factor(replicated_factor_threshold, A))
+    {
+      El::DistMatrix<El::BigFloat, El::STAR, El::STAR> A_star(A);
+      El::Cholesky(El::UpperOrLowerNS::LOWER, A_star.Matrix());
+      El::Copy(A_star, A);
+    }
+  else
+    {
+      El::Cholesky(El::UpperOrLowerNS::LOWER, A);
+    }
+}
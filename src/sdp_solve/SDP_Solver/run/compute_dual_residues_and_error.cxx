@@ -1,5 +1,7 @@
 #include "../../SDP_Solver.hxx"
 
+#include <algorithm>
+
 // dualResidues[p] = primalObjective[p] - Tr(A_p Y) - (FreeVarMatrix y)_p,
 // for 0 <= p < primalObjective.size()
 //
@@ -9,6 +11,16 @@
 //                       (1/2) (BilinearPairingsY_{ej r + k, ej s + k} +
 //                              swap (r <-> s))
 // where ej = d_j + 1.
+//
+// Each process adds up the diagonal elements of BilinearPairingsY and
+// the products (FreeVarMatrix y)_p from its own local data, in one
+// sweep that needs no temporary distributed matrices.  A single
+// AllReduce per block then gives the total for every p, and each
+// process fills in its local entries of dualResidues and tracks their
+// largest absolute value.
+//
+// dual_error is the largest residue on this process.  It still has to
+// be combined with the other processes.
 
 void compute_dual_residues_and_error(
   const Block_Info &block_info, const SDP &sdp, const Block_Vector &y,
@@ -21,74 +33,107 @@ void compute_dual_residues_and_error(
   auto primal_objective_c_block(sdp.primal_objective_c.blocks.begin());
   auto y_block(y.blocks.begin());
   auto free_var_matrix_block(sdp.free_var_matrix.blocks.begin());
+  auto free_var_column_offset(sdp.free_var_column_offsets.begin());
   auto bilinear_pairings_Y_block(bilinear_pairings_Y.blocks.begin());
 
+  const El::BigFloat zero(0), half(0.5);
   El::BigFloat local_max(0);
   for(auto &block_index : block_info.block_indices)
     {
-      Zero(*dual_residues_block);
-      const size_t block_size(block_info.degrees[block_index] + 1);
+      const size_t block_size(block_info.degrees[block_index] + 1),
+        dimension(block_info.dimensions[block_index]);
 
-      // Not sure whether it is better to first loop over blocks in
-      // the result or over sub-blocks in bilinear_pairings_Y
-      for(size_t bb = 2 * block_index; bb < 2 * block_index + 2; ++bb)
+      // subtracted[p] = Tr(A_p Y) + (FreeVarMatrix y)_p
+      std::vector<El::BigFloat> subtracted(dual_residues_block->Height(),
+                                           zero);
+      for(size_t parity = 0; parity < 2; ++parity)
         {
-          for(size_t column_block = 0;
-              column_block < block_info.dimensions[block_index];
-              ++column_block)
-            for(size_t row_block = 0; row_block <= column_block; ++row_block)
-              {
-                size_t column_offset(column_block * block_size),
-                  row_offset(row_block * block_size);
-
-                El::DistMatrix<El::BigFloat> lower_diagonal(El::GetDiagonal(
-                  El::LockedView(*bilinear_pairings_Y_block, row_offset,
-                                 column_offset, block_size, block_size)));
-
-                size_t residue_row_offset(
-                  ((column_block * (column_block + 1)) / 2 + row_block)
-                  * block_size);
-
-                El::DistMatrix<El::BigFloat> residue_sub_block(El::View(
-                  *dual_residues_block, residue_row_offset, 0, block_size, 1));
-
-                // Do a little less work when on a diagonal block.
-                if(column_offset == row_offset)
-                  {
-                    El::Axpy(El::BigFloat(-1.0), lower_diagonal,
-                             residue_sub_block);
-                  }
-                else
-                  {
-                    El::Axpy(El::BigFloat(-0.5), lower_diagonal,
-                             residue_sub_block);
-
-                    El::DistMatrix<El::BigFloat> upper_diagonal(
-                      El::GetDiagonal(El::LockedView(
-                        *bilinear_pairings_Y_block, column_offset, row_offset,
-                        block_size, block_size)));
-
-                    El::Axpy(El::BigFloat(-0.5), upper_diagonal,
-                             residue_sub_block);
-                  }
-              }
+          const El::DistMatrix<El::BigFloat> &pairings(
+            *bilinear_pairings_Y_block);
+          const El::Matrix<El::BigFloat> &pairings_local(
+            pairings.LockedMatrix());
+          for(int64_t local_column = 0; local_column < pairings.LocalWidth();
+              ++local_column)
+            {
+              const size_t global_column(pairings.GlobalCol(local_column)),
+                column_block(global_column / block_size),
+                k(global_column % block_size);
+              // Only the diagonals of the sub-blocks contribute.
+              for(size_t row_block = 0; row_block < dimension; ++row_block)
+                {
+                  const int64_t global_row(row_block * block_size + k);
+                  if(!pairings.IsLocalRow(global_row))
+                    {
+                      continue;
+                    }
+                  const size_t r(std::min(row_block, column_block)),
+                    s(std::max(row_block, column_block));
+                  El::BigFloat &element(
+                    subtracted[((s * (s + 1)) / 2 + r) * block_size + k]);
+                  if(r == s)
+                    {
+                      element += pairings_local(pairings.LocalRow(global_row),
+                                                local_column);
+                    }
+                  else
+                    {
+                      element += half
+                                 * pairings_local(
+                                   pairings.LocalRow(global_row), local_column);
+                    }
+                }
+            }
           ++bilinear_pairings_Y_block;
         }
-      // dualResidues -= FreeVarMatrix * y
-      Gemm(El::Orientation::NORMAL, El::Orientation::NORMAL, El::BigFloat(-1),
-           *free_var_matrix_block, *y_block, El::BigFloat(1),
-           *dual_residues_block);
-      // dualResidues += primalObjective
-      Axpy(El::BigFloat(1), *primal_objective_c_block, *dual_residues_block);
 
-      local_max = Max(local_max, El::MaxAbs(*dual_residues_block));
+      // FreeVarMatrix y, using only the stored columns of FreeVarMatrix.
+      if(free_var_matrix_block->Width() != 0)
+        {
+          const El::DistMatrix<El::BigFloat, El::STAR, El::STAR> y_star(
+            El::LockedView(*y_block, *free_var_column_offset, 0,
+                           free_var_matrix_block->Width(), 1));
+          const El::Matrix<El::BigFloat> &y_local(y_star.LockedMatrix()),
+            &free_var_local(free_var_matrix_block->LockedMatrix());
+          for(int64_t row = 0; row < free_var_matrix_block->LocalHeight();
+              ++row)
+            {
+              El::BigFloat &element(
+                subtracted[free_var_matrix_block->GlobalRow(row)]);
+              for(int64_t column = 0;
+                  column < free_var_matrix_block->LocalWidth(); ++column)
+                {
+                  element
+                    += free_var_local(row, column)
+                       * y_local(free_var_matrix_block->GlobalCol(column), 0);
+                }
+            }
+        }
+      El::mpi::AllReduce(subtracted.data(), subtracted.size(), El::mpi::SUM,
+                         dual_residues_block->DistComm());
+
+      // dualResidues = primalObjective - subtracted
+      El::Matrix<El::BigFloat> &residues_local(dual_residues_block->Matrix());
+      const El::Matrix<El::BigFloat> &c_local(
+        primal_objective_c_block->LockedMatrix());
+      for(int64_t row = 0; row < dual_residues_block->LocalHeight(); ++row)
+        {
+          const El::BigFloat &subtracted_p(
+            subtracted[dual_residues_block->GlobalRow(row)]);
+          for(int64_t column = 0; column < dual_residues_block->LocalWidth();
+              ++column)
+            {
+              El::BigFloat &residue(residues_local(row, column));
+              residue = c_local(row, column) - subtracted_p;
+              local_max = El::Max(local_max, El::Abs(residue));
+            }
+        }
 
       ++primal_objective_c_block;
       ++y_block;
       ++free_var_matrix_block;
+      ++free_var_column_offset;
       ++dual_residues_block;
     }
-  dual_error
-    = El::mpi::AllReduce(local_max, El::mpi::MAX, El::mpi::COMM_WORLD);
+  dual_error = local_max;
   dual_residues_timer.stop();
 }
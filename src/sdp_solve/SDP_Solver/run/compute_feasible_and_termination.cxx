@@ -5,9 +5,7 @@ void compute_feasible_and_termination(
   const SDP_Solver_Parameters &parameters, const El::BigFloat &primal_error,
   const El::BigFloat &dual_error, const El::BigFloat &duality_gap,
   const El::BigFloat &primal_step_length, const El::BigFloat &dual_step_length,
-  const int &iteration,
-  const std::chrono::time_point<std::chrono::high_resolution_clock>
-    &solver_start_time,
+  const int &iteration, const int64_t &solver_runtime,
   bool &is_primal_and_dual_feasible,
   SDP_Solver_Terminate_Reason &terminate_reason, bool &terminate_now)
 {
@@ -45,10 +43,7 @@ void compute_feasible_and_termination(
     {
       terminate_reason = SDP_Solver_Terminate_Reason::MaxIterationsExceeded;
     }
-  else if(std::chrono::duration_cast<std::chrono::seconds>(
-            std::chrono::high_resolution_clock::now() - solver_start_time)
-            .count()
-          >= parameters.max_runtime)
+  else if(solver_runtime >= parameters.max_runtime)
     {
       terminate_reason = SDP_Solver_Terminate_Reason::MaxRuntimeExceeded;
     }
@@ -56,8 +51,4 @@ void compute_feasible_and_termination(
     {
       terminate_now = false;
     }
-  El::byte terminate_byte(terminate_now);
-  // Time varies between cores, so follow the decision of the root.
-  El::mpi::Broadcast(terminate_byte, 0, El::mpi::COMM_WORLD);
-  terminate_now = static_cast<bool>(terminate_byte);
 }
@@ -0,0 +1,38 @@
+#include "../../SDP.hxx"
+#include "../../Extended_Sum.hxx"
+
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins);
+
+// The largest absolute values of the elements of c and b.  These are
+// used to normalize the infeasibility certificates (see
+// detect_infeasibility).
+void compute_max_abs_objectives(const SDP &sdp, const El::mpi::Comm &comm,
+                                El::BigFloat &max_abs_c,
+                                El::BigFloat &max_abs_b)
+{
+  std::vector<El::BigFloat> maxes(2, El::BigFloat(0)), mins;
+  for(auto &block : sdp.primal_objective_c.blocks)
+    {
+      const El::Matrix<El::BigFloat> &local(block.LockedMatrix());
+      for(int64_t row = 0; row < local.Height(); ++row)
+        for(int64_t column = 0; column < local.Width(); ++column)
+          {
+            maxes[0] = El::Max(maxes[0], El::Abs(local(row, column)));
+          }
+    }
+  const El::Matrix<El::BigFloat> &b_local(
+    sdp.dual_objective_b.LockedMatrix());
+  for(int64_t row = 0; row < b_local.Height(); ++row)
+    for(int64_t column = 0; column < b_local.Width(); ++column)
+      {
+        maxes[1] = El::Max(maxes[1], El::Abs(b_local(row, column)));
+      }
+
+  std::vector<Extended_Sum> sums;
+  fused_all_reduce(comm, sums, maxes, mins);
+  max_abs_c = maxes[0];
+  max_abs_b = maxes[1];
+}
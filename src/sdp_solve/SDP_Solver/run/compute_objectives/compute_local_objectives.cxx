@@ -0,0 +1,33 @@
+#include "../../../SDP.hxx"
+#include "../../../../Timers.hxx"
+#include "../../../elementwise.hxx"
+
+Extended_Sum local_dot(const Block_Vector &a, const Block_Vector &b);
+
+// Compute this process's contributions to c.x and b.y.  These still
+// have to be summed over all processes before adding objective_const.
+void compute_local_objectives(const SDP &sdp, const Block_Vector &x,
+                              const Block_Vector &y,
+                              const El::mpi::Comm &comm,
+                              Extended_Sum &primal_objective_local,
+                              Extended_Sum &dual_objective_local,
+                              Timers &timers)
+{
+  auto &objectives_timer(timers.add_and_start("run.objectives"));
+  primal_objective_local = local_dot(sdp.primal_objective_c, x);
+  // dual_objective_b is duplicated amongst the groups.  y is
+  // duplicated amongst the blocks.  So we only use the first block of
+  // the group that contains the root process.  Groups are contiguous
+  // ranges of the processes in comm, so that group is the one where
+  // the group rank matches the rank in comm.
+  //
+  // It is possible for some processors to have no blocks.
+  dual_objective_local = Extended_Sum();
+  if(!y.blocks.empty()
+     && y.blocks.front().Grid().Rank() == El::mpi::Rank(comm))
+    {
+      elementwise_dotu(sdp.dual_objective_b.LockedMatrix(),
+                       y.blocks.front().LockedMatrix(), dual_objective_local);
+    }
+  objectives_timer.stop();
+}
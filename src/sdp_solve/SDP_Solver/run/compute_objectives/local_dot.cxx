@@ -0,0 +1,19 @@
+#include "../../../Block_Vector.hxx"
+#include "../../../elementwise.hxx"
+
+#include <cassert>
+
+// This process's contribution to A.B.  Every element of a block is
+// owned by exactly one process, so summing the local dot products over
+// all processes gives the full dot product.
+Extended_Sum local_dot(const Block_Vector &A, const Block_Vector &B)
+{
+  assert(A.blocks.size() == B.blocks.size());
+  Extended_Sum local_sum;
+  for(size_t ii = 0; ii != A.blocks.size(); ++ii)
+    {
+      elementwise_dotu(A.blocks[ii].LockedMatrix(),
+                       B.blocks[ii].LockedMatrix(), local_sum);
+    }
+  return local_sum;
+}
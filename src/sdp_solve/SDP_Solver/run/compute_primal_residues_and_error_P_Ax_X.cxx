@@ -1,6 +1,9 @@
 #include "constraint_matrix_weighted_sum.hxx"
 
 // PrimalResidues = \sum_p A_p x[p] - X
+//
+// primal_error is the largest residue on this process.  It still has
+// to be combined with the other processes.
 
 void compute_primal_residues_and_error_P_Ax_X(
   const Block_Info &block_info, const SDP &sdp, const Block_Vector &x,
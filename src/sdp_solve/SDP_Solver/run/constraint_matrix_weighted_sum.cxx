@@ -1,5 +1,7 @@
 #include "../../SDP_Solver.hxx"
 
+#include <algorithm>
+
 // result = \sum_p a[p] A_p,
 //
 // where a[p] is a vector of length primalObjective.size() and the
@@ -10,6 +12,16 @@
 //
 // where v_{b,k} is the k-th column of bilinear_bases[b], as described
 // in SDP.h.
+//
+// Each local element of result is computed directly from the
+// replicated bilinear bases.  For the element in row i of sub-block
+// row r and column j of sub-block column s,
+//
+//   result = \sum_k a[(min(r,s),max(r,s),k)] v_k(i) v_k(j) / (2 or 1)
+//
+// The weights a[..] v_k(j) are shared by every row of a local column,
+// so they are computed once per column.  Filling in both triangles
+// locally avoids the communication in MakeSymmetric.
 
 void constraint_matrix_weighted_sum(const Block_Info &block_info,
                                     const SDP &sdp, const Block_Vector &a,
@@ -17,46 +29,63 @@ void constraint_matrix_weighted_sum(const Block_Info &block_info,
 {
   auto a_block(a.blocks.begin());
   auto result_block(result.blocks.begin());
-  auto bilinear_bases_block(sdp.bilinear_bases_dist.begin());
+  auto bilinear_bases_block(sdp.bilinear_bases_local.begin());
 
+  const El::BigFloat half(0.5);
   for(auto &block_index : block_info.block_indices)
     {
-      const size_t block_size(block_info.degrees[block_index] + 1);
+      const size_t block_size(block_info.degrees[block_index] + 1),
+        dimension(block_info.dimensions[block_index]);
+      const El::DistMatrix<El::BigFloat, El::STAR, El::STAR> a_star(
+        *a_block);
+      const El::Matrix<El::BigFloat> &a_local(a_star.LockedMatrix());
+
+      // column_weights[row_block, k] = a[(r,s,k)] v_k(column) / (2 or 1)
+      std::vector<El::BigFloat> column_weights(dimension * block_size);
       for(size_t parity = 0; parity < 2; ++parity)
         {
-          // TODO: Remove this because it gets zero'd out in Gemm?
-          El::Zero(*result_block);
-          for(size_t column_block = 0;
-              column_block < block_info.dimensions[block_index];
-              ++column_block)
-            for(size_t row_block = 0; row_block <= column_block; ++row_block)
-              {
-                const size_t result_block_size(bilinear_bases_block->Height());
-                const size_t column_offset(column_block * result_block_size),
-                  row_offset(row_block * result_block_size);
-                size_t vector_offset(
-                  ((column_block * (column_block + 1)) / 2 + row_block)
-                  * block_size);
-                El::DistMatrix<El::BigFloat> sub_vector(
-                  El::LockedView(*a_block, vector_offset, 0, block_size, 1));
-                El::DistMatrix<El::BigFloat> scaled_bases(
-                  *bilinear_bases_block);
+          const El::Matrix<El::BigFloat> &bases(*bilinear_bases_block);
+          const size_t result_block_size(bases.Height());
+          El::Matrix<El::BigFloat> &result_local(result_block->Matrix());
+          for(int64_t local_column = 0;
+              local_column < result_block->LocalWidth(); ++local_column)
+            {
+              const size_t global_column(
+                result_block->GlobalCol(local_column)),
+                column_block(global_column / result_block_size),
+                column(global_column % result_block_size);
 
-                El::DiagonalScale(El::LeftOrRight::RIGHT,
-                                  El::Orientation::NORMAL, sub_vector,
-                                  scaled_bases);
+              for(size_t row_block = 0; row_block < dimension; ++row_block)
+                {
+                  const size_t r(std::min(row_block, column_block)),
+                    s(std::max(row_block, column_block)),
+                    vector_offset(((s * (s + 1)) / 2 + r) * block_size);
+                  for(size_t k = 0; k < block_size; ++k)
+                    {
+                      El::BigFloat &weight(
+                        column_weights[row_block * block_size + k]);
+                      weight = a_local(vector_offset + k, 0) * bases(column, k);
+                      if(r != s)
+                        {
+                          weight *= half;
+                        }
+                    }
+                }
 
-                El::DistMatrix<El::BigFloat> result_sub_block(
-                  El::View(*result_block, row_offset, column_offset,
-                           result_block_size, result_block_size));
-                El::Gemm(El::Orientation::NORMAL, El::Orientation::TRANSPOSE,
-                         El::BigFloat(column_block == row_block ? 1 : 0.5),
-                         *bilinear_bases_block, scaled_bases, El::BigFloat(0),
-                         result_sub_block);
-              }
-          if(block_info.dimensions[block_index] > 1)
-            {
-              El::MakeSymmetric(El::UpperOrLowerNS::UPPER, *result_block);
+              for(int64_t local_row = 0;
+                  local_row < result_block->LocalHeight(); ++local_row)
+                {
+                  const size_t global_row(result_block->GlobalRow(local_row)),
+                    row_block(global_row / result_block_size),
+                    row(global_row % result_block_size);
+                  El::BigFloat &element(result_local(local_row, local_column));
+                  element = 0;
+                  for(size_t k = 0; k < block_size; ++k)
+                    {
+                      element += bases(row, k)
+                                 * column_weights[row_block * block_size + k];
+                    }
+                }
             }
           ++result_block;
           ++bilinear_bases_block;
@@ -0,0 +1,64 @@
+#include "../../SDP_Solver_Terminate_Reason.hxx"
+#include "../../SDP_Solver_Parameters.hxx"
+
+// Look for a certificate that the primal or dual problem is
+// infeasible, using the current point.
+//
+// The primal is infeasible if there is a (y, Y) with Y >= 0,
+//
+//   Tr(A_p Y) + (B y)_p = 0  and  b.y > 0,
+//
+// because then 0 = x.(Tr(A_p Y) + (B y)_p) = Tr(X Y) + b.y > 0 for
+// any primal feasible x.  When the primal is infeasible, the dual
+// objective b.y of the infeasible-start iterates grows without bound
+// while Tr(A_p Y) + (B y)_p = c_p - dual_residues_p stays bounded.  So
+// (y, Y)/(b.y) becomes a certificate, with a violation of at most
+//
+//   (max|c| + dual_error) / b.y
+//
+// Likewise, the dual is infeasible if there is an x with
+// \sum_p A_p x_p >= 0, B^T x = 0 and c.x < 0.  (x, X)/(-c.x) violates
+// these by at most
+//
+//   (max|b| + primal_error_p + primal_error_P) / (-c.x)
+//
+// Either certificate is accepted once its violation is below
+// infeasibilityThreshold.  Infeasible problems are then detected as
+// soon as the objective has grown large compared to the errors,
+// rather than after hitting maxIterations or maxComplementarity.
+
+bool detect_infeasibility(const SDP_Solver_Parameters &parameters,
+                          const El::BigFloat &objective_const,
+                          const El::BigFloat &max_abs_c,
+                          const El::BigFloat &max_abs_b,
+                          const El::BigFloat &primal_objective,
+                          const El::BigFloat &dual_objective,
+                          const El::BigFloat &primal_error_P,
+                          const El::BigFloat &primal_error_p,
+                          const El::BigFloat &dual_error,
+                          SDP_Solver_Terminate_Reason &terminate_reason)
+{
+  const El::BigFloat zero(0);
+  if(parameters.infeasibility_threshold == zero)
+    {
+      return false;
+    }
+
+  // b.y and -c.x
+  const El::BigFloat b_y(dual_objective - objective_const),
+    minus_c_x(objective_const - primal_objective);
+  if(b_y > zero
+     && max_abs_c + dual_error <= parameters.infeasibility_threshold * b_y)
+    {
+      terminate_reason = SDP_Solver_Terminate_Reason::PrimalInfeasible;
+      return true;
+    }
+  if(minus_c_x > zero
+     && max_abs_b + primal_error_p + primal_error_P
+          <= parameters.infeasibility_threshold * minus_c_x)
+    {
+      terminate_reason = SDP_Solver_Terminate_Reason::DualInfeasible;
+      return true;
+    }
+  return false;
+}
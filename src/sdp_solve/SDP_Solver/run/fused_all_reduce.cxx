@@ -0,0 +1,160 @@
+#include "../../Extended_Sum.hxx"
+
+#include <El.hpp>
+
+#include <vector>
+
+// Sum 'sums', and take the maximum of 'maxes' and the minimum of
+// 'mins', over all processes with a single reduction.  Each of these
+// reductions is latency bound, so doing them all at once is much
+// cheaper than doing them one at a time.
+//
+// The sums are Extended_Sums.  Each one is sent as a pair of
+// BigFloats, high + low, and the pairs are added with the extended
+// precision, so the total keeps the extended precision no matter how
+// many processes there are.
+//
+// Every element of the reduction is self-describing: a kind followed
+// by two values.  For a sum, the values are (high, low).  For a max,
+// the first value is the max and the second is unused.  Minimums are
+// sent as maximums of the negated values.  The elements are a
+// contiguous MPI datatype, so MPI may split the buffer into segments
+// anywhere it likes without separating an element from its kind.
+
+namespace
+{
+  const int sum_kind(0), max_kind(1), values_per_element(3);
+
+  void sum_or_max(void *in, void *inout, int *length, MPI_Datatype *)
+  {
+    const El::byte *in_bytes(static_cast<const El::byte *>(in));
+    El::byte *inout_bytes(static_cast<El::byte *>(inout));
+
+    El::BigFloat kind, in_value, inout_value;
+    const size_t serialized_size(kind.SerializedSize());
+    for(int element = 0; element < *length; ++element)
+      {
+        const size_t position(element * values_per_element
+                              * serialized_size);
+        kind.Deserialize(in_bytes + position);
+        const El::byte *in_first(in_bytes + position + serialized_size);
+        El::byte *inout_first(inout_bytes + position + serialized_size);
+        if(kind == El::BigFloat(sum_kind))
+          {
+            Extended_Sum sum;
+            for(int offset = 0; offset < 2; ++offset)
+              {
+                in_value.Deserialize(in_first + offset * serialized_size);
+                sum.add(in_value);
+                inout_value.Deserialize(inout_first
+                                        + offset * serialized_size);
+                sum.add(inout_value);
+              }
+            El::BigFloat high, low;
+            sum.split(high, low);
+            high.Serialize(inout_first);
+            low.Serialize(inout_first + serialized_size);
+          }
+        else
+          {
+            in_value.Deserialize(in_first);
+            inout_value.Deserialize(inout_first);
+            if(in_value > inout_value)
+              {
+                in_value.Serialize(inout_first);
+              }
+          }
+      }
+  }
+
+  MPI_Op create_sum_or_max()
+  {
+    MPI_Op result;
+    MPI_Op_create(sum_or_max, true, &result);
+    return result;
+  }
+
+  MPI_Datatype create_element_type()
+  {
+    MPI_Datatype result;
+    MPI_Type_contiguous(values_per_element, El::mpi::TypeMap<El::BigFloat>(),
+                        &result);
+    MPI_Type_commit(&result);
+    return result;
+  }
+
+  void serialize_element(const int &kind, const El::BigFloat &first,
+                         const El::BigFloat &second,
+                         const size_t &serialized_size, El::byte *&current)
+  {
+    El::BigFloat(kind).Serialize(current);
+    current += serialized_size;
+    first.Serialize(current);
+    current += serialized_size;
+    second.Serialize(current);
+    current += serialized_size;
+  }
+}
+
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins)
+{
+  static MPI_Op sum_or_max_op(create_sum_or_max());
+  static MPI_Datatype element_type(create_element_type());
+
+  const size_t num_elements(sums.size() + maxes.size() + mins.size());
+  const size_t serialized_size(El::BigFloat(0).SerializedSize());
+  std::vector<El::byte> buffer(num_elements * values_per_element
+                               * serialized_size);
+
+  El::byte *current(buffer.data());
+  const El::BigFloat zero(0);
+  for(auto &sum : sums)
+    {
+      El::BigFloat high, low;
+      sum.split(high, low);
+      serialize_element(sum_kind, high, low, serialized_size, current);
+    }
+  for(auto &max : maxes)
+    {
+      serialize_element(max_kind, max, zero, serialized_size, current);
+    }
+  for(auto &min : mins)
+    {
+      serialize_element(max_kind, -min, zero, serialized_size, current);
+    }
+
+  MPI_Allreduce(MPI_IN_PLACE, buffer.data(), num_elements, element_type,
+                sum_or_max_op, comm.comm);
+
+  // Skip over the kind at the start of each element, and the unused
+  // second value of the maxes.
+  current = buffer.data();
+  El::BigFloat high, low;
+  for(auto &sum : sums)
+    {
+      current += serialized_size;
+      high.Deserialize(current);
+      current += serialized_size;
+      low.Deserialize(current);
+      current += serialized_size;
+      sum = Extended_Sum();
+      sum.add(high);
+      sum.add(low);
+    }
+  for(auto &max : maxes)
+    {
+      current += serialized_size;
+      max.Deserialize(current);
+      current += 2 * serialized_size;
+    }
+  for(auto &min : mins)
+    {
+      current += serialized_size;
+      min.Deserialize(current);
+      min = -min;
+      current += 2 * serialized_size;
+    }
+}
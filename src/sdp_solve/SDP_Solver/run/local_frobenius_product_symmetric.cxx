@@ -0,0 +1,17 @@
+#include "../../Block_Diagonal_Matrix.hxx"
+#include "../../elementwise.hxx"
+
+// This process's contribution to Tr(A B), where A and B are
+// symmetric.  Every element of a block is owned by exactly one
+// process, so summing over all processes gives the full product.
+Extended_Sum local_frobenius_product_symmetric(const Block_Diagonal_Matrix &A,
+                                               const Block_Diagonal_Matrix &B)
+{
+  Extended_Sum local_sum;
+  for(size_t b = 0; b < A.blocks.size(); b++)
+    {
+      elementwise_dotu(A.blocks[b].LockedMatrix(), B.blocks[b].LockedMatrix(),
+                       local_sum);
+    }
+  return local_sum;
+}
@@ -0,0 +1,31 @@
+#include <El.hpp>
+
+bool use_replicated_factor(const size_t &replicated_factor_threshold,
+                           const El::DistMatrix<El::BigFloat> &A);
+
+// B := L^{-1} B, where L is lower triangular.
+//
+// When L is replicated (see cholesky_lower), B is redistributed so
+// that each process holds complete columns, and each process solves
+// for its own columns with no further communication.
+
+void lower_triangular_solve(const size_t &replicated_factor_threshold,
+                            const El::DistMatrix<El::BigFloat> &L,
+                            El::DistMatrix<El::BigFloat> &B)
+{
+  if(use_replicated_factor(replicated_factor_threshold, L))
+    {
+      const El::DistMatrix<El::BigFloat, El::STAR, El::STAR> L_star(L);
+      El::DistMatrix<El::BigFloat, El::STAR, El::VR> B_columns(B);
+      El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+               El::OrientationNS::NORMAL, El::UnitOrNonUnitNS::NON_UNIT,
+               El::BigFloat(1), L_star.LockedMatrix(), B_columns.Matrix());
+      El::Copy(B_columns, B);
+    }
+  else
+    {
+      El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+               El::OrientationNS::NORMAL, El::UnitOrNonUnitNS::NON_UNIT,
+               El::BigFloat(1), L, B);
+    }
+}
@@ -10,9 +10,9 @@ void print_iteration(
   const El::BigFloat &beta_corrector, const SDP_Solver &sdp_solver,
   const std::chrono::time_point<std::chrono::high_resolution_clock>
   &solver_start_time,
-                     const Verbosity &verbosity)
+                     const Verbosity &verbosity, const El::mpi::Comm &comm)
 {
-  if(verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
+  if(verbosity >= Verbosity::regular && El::mpi::Rank(comm) == 0)
     {
       std::cout << std::left << std::setw(4) << iteration << "  "
 
@@ -2,22 +2,33 @@
 
 // The main solver loop
 
-void cholesky_decomposition(const Block_Diagonal_Matrix &A,
+void cholesky_decomposition(const size_t &replicated_factor_threshold,
+                            const Block_Diagonal_Matrix &A,
                             Block_Diagonal_Matrix &L);
 
-void print_header(const Verbosity &verbosity);
+void print_header(const Verbosity &verbosity, const El::mpi::Comm &comm);
 void print_iteration(
   const int &iteration, const El::BigFloat &mu,
   const El::BigFloat &primal_step_length, const El::BigFloat &dual_step_length,
   const El::BigFloat &beta_corrector, const SDP_Solver &sdp_solver,
   const std::chrono::time_point<std::chrono::high_resolution_clock>
     &solver_start_time,
-  const Verbosity &verbosity);
+  const Verbosity &verbosity, const El::mpi::Comm &comm);
 
-void compute_objectives(const SDP &sdp, const Block_Vector &x,
-                        const Block_Vector &y, El::BigFloat &primal_objective,
-                        El::BigFloat &dual_objective,
-                        El::BigFloat &duality_gap, Timers &timers);
+void compute_local_objectives(const SDP &sdp, const Block_Vector &x,
+                              const Block_Vector &y,
+                              const El::mpi::Comm &comm,
+                              Extended_Sum &primal_objective_local,
+                              Extended_Sum &dual_objective_local,
+                              Timers &timers);
+
+Extended_Sum local_frobenius_product_symmetric(const Block_Diagonal_Matrix &A,
+                                               const Block_Diagonal_Matrix &B);
+
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins);
 
 void compute_bilinear_pairings(
   const Block_Diagonal_Matrix &X_cholesky, const Block_Diagonal_Matrix &Y,
@@ -30,12 +41,25 @@ void compute_feasible_and_termination(
   const SDP_Solver_Parameters &parameters, const El::BigFloat &primal_error,
   const El::BigFloat &dual_error, const El::BigFloat &duality_gap,
   const El::BigFloat &primal_step_length, const El::BigFloat &dual_step_length,
-  const int &iteration,
-  const std::chrono::time_point<std::chrono::high_resolution_clock>
-    &solver_start_time,
+  const int &iteration, const int64_t &solver_runtime,
   bool &is_primal_and_dual_feasible,
   SDP_Solver_Terminate_Reason &terminate_reason, bool &terminate_now);
 
+bool detect_infeasibility(const SDP_Solver_Parameters &parameters,
+                          const El::BigFloat &objective_const,
+                          const El::BigFloat &max_abs_c,
+                          const El::BigFloat &max_abs_b,
+                          const El::BigFloat &primal_objective,
+                          const El::BigFloat &dual_objective,
+                          const El::BigFloat &primal_error_P,
+                          const El::BigFloat &primal_error_p,
+                          const El::BigFloat &dual_error,
+                          SDP_Solver_Terminate_Reason &terminate_reason);
+
+void compute_max_abs_objectives(const SDP &sdp, const El::mpi::Comm &comm,
+                                El::BigFloat &max_abs_c,
+                                El::BigFloat &max_abs_b);
+
 void compute_dual_residues_and_error(
   const Block_Info &block_info, const SDP &sdp, const Block_Vector &y,
   const Block_Diagonal_Matrix &bilinear_pairings_Y,
@@ -52,6 +76,9 @@ void compute_primal_residues_and_error_p_b_Bx(const Block_Info &block_info,
                                               Block_Vector &primal_residue_p,
                                               El::BigFloat &primal_error_p);
 
+bool use_node_local_Q(const SDP_Solver_Parameters &parameters,
+                      const Block_Info &block_info);
+
 SDP_Solver_Terminate_Reason
 SDP_Solver::run(const SDP_Solver_Parameters &parameters,
                 const Block_Info &block_info, const SDP &sdp,
@@ -105,36 +132,43 @@ SDP_Solver::run(const SDP_Solver_Parameters &parameters,
         ++bilinear_pairings_X_inv_block;
       }
   }
-  print_header(parameters.verbosity);
+  // Q is either distributed over all processes, or replicated on
+  // every node.
+  El::Grid Q_grid(use_node_local_Q(parameters, block_info)
+                    ? block_info.node_comm.value
+                    : block_info.solver_comm);
+
+  print_header(parameters.verbosity, block_info.solver_comm);
 
   std::size_t total_psd_rows(
     std::accumulate(block_info.psd_matrix_block_sizes.begin(),
                     block_info.psd_matrix_block_sizes.end(), size_t(0)));
 
+  El::BigFloat max_abs_c(0), max_abs_b(0);
+  if(parameters.infeasibility_threshold != El::BigFloat(0))
+    {
+      compute_max_abs_objectives(sdp, block_info.solver_comm, max_abs_c,
+                                 max_abs_b);
+    }
+
   initialize_timer.stop();
   auto last_checkpoint_time(std::chrono::high_resolution_clock::now());
   for(size_t iteration = 1;; ++iteration)
     {
-      El::byte checkpoint_now(
-        std::chrono::duration_cast<std::chrono::seconds>(
-          std::chrono::high_resolution_clock::now() - last_checkpoint_time)
-          .count()
-        >= parameters.checkpoint_interval);
-      // Time varies between cores, so follow the decision of the root.
-      El::mpi::Broadcast(checkpoint_now, 0, El::mpi::COMM_WORLD);
-      if(checkpoint_now == true)
-        {
-          save_checkpoint(parameters);
-          last_checkpoint_time = std::chrono::high_resolution_clock::now();
-        }
-
-      compute_objectives(sdp, x, y, primal_objective, dual_objective,
-                         duality_gap, timers);
+      // All of the errors and objectives computed below are local to
+      // this process.  They are combined with a single reduction
+      // afterwards.
+      Extended_Sum primal_objective_local, dual_objective_local;
+      compute_local_objectives(sdp, x, y, block_info.solver_comm,
+                               primal_objective_local, dual_objective_local,
+                               timers);
 
       auto &cholesky_decomposition_timer(
         timers.add_and_start("run.choleskyDecomposition"));
-      cholesky_decomposition(X, X_cholesky);
-      cholesky_decomposition(Y, Y_cholesky);
+      cholesky_decomposition(parameters.replicated_factor_threshold, X,
+                             X_cholesky);
+      cholesky_decomposition(parameters.replicated_factor_threshold, Y,
+                             Y_cholesky);
       cholesky_decomposition_timer.stop();
 
       compute_bilinear_pairings(
@@ -152,31 +186,88 @@ SDP_Solver::run(const SDP_Solver_Parameters &parameters,
       compute_primal_residues_and_error_p_b_Bx(
         block_info, sdp, x, primal_residue_p, primal_error_p);
 
+      // The complementarity mu = Tr(X Y)/X.dim
+      auto &frobenius_timer(
+        timers.add_and_start("run.frobenius_product_symmetric"));
+      const Extended_Sum trace_XY_local(
+        local_frobenius_product_symmetric(X, Y));
+      frobenius_timer.stop();
+
+      // Time varies between cores, so only use the times from the
+      // root.
+      const auto now(std::chrono::high_resolution_clock::now());
+      const bool is_root(El::mpi::Rank(block_info.solver_comm) == 0);
+      const double solver_seconds(
+        is_root ? std::chrono::duration_cast<std::chrono::seconds>(
+                    now - solver_timer.start_time)
+                    .count()
+                : 0),
+        checkpoint_seconds(
+          is_root ? std::chrono::duration_cast<std::chrono::seconds>(
+                      now - last_checkpoint_time)
+                      .count()
+                  : 0);
+
+      std::vector<Extended_Sum> sums(
+        {primal_objective_local, dual_objective_local, trace_XY_local});
+      std::vector<El::BigFloat> maxes({dual_error, primal_error_P,
+                                       primal_error_p,
+                                       El::BigFloat(solver_seconds),
+                                       El::BigFloat(checkpoint_seconds)}),
+        mins;
+      auto &reduce_timer(timers.add_and_start("run.fusedAllReduce"));
+      fused_all_reduce(block_info.solver_comm, sums, maxes, mins);
+      reduce_timer.stop();
+
+      primal_objective = sdp.objective_const + sums[0].value();
+      dual_objective = sdp.objective_const + sums[1].value();
+      duality_gap
+        = Abs(primal_objective - dual_objective)
+          / Max(Abs(primal_objective) + Abs(dual_objective), El::BigFloat(1));
+      const El::BigFloat mu(sums[2].value() / total_psd_rows);
+
+      dual_error = maxes[0];
+      primal_error_P = maxes[1];
+      primal_error_p = maxes[2];
+      const int64_t solver_runtime(static_cast<double>(maxes[3]));
+
+      if(static_cast<double>(maxes[4]) >= parameters.checkpoint_interval)
+        {
+          save_checkpoint(parameters, block_info);
+          last_checkpoint_time = std::chrono::high_resolution_clock::now();
+        }
+
       bool terminate_now, is_primal_and_dual_feasible;
       compute_feasible_and_termination(
         parameters, primal_error(), dual_error, duality_gap,
-        primal_step_length, dual_step_length, iteration,
-        solver_timer.start_time, is_primal_and_dual_feasible, terminate_reason,
-        terminate_now);
+        primal_step_length, dual_step_length, iteration, solver_runtime,
+        is_primal_and_dual_feasible, terminate_reason, terminate_now);
       if(terminate_now)
         {
           break;
         }
-
-      El::BigFloat mu, beta_corrector;
-      step(parameters, total_psd_rows, is_primal_and_dual_feasible, block_info,
-           sdp, grid, X_cholesky, Y_cholesky, bilinear_pairings_X_inv,
-           bilinear_pairings_Y, primal_residue_p, mu, beta_corrector,
-           primal_step_length, dual_step_length, terminate_now, timers);
-      if(terminate_now)
+      if(detect_infeasibility(parameters, sdp.objective_const, max_abs_c,
+                              max_abs_b, primal_objective, dual_objective,
+                              primal_error_P, primal_error_p, dual_error,
+                              terminate_reason))
+        {
+          break;
+        }
+      if(mu > parameters.max_complementarity)
         {
           terminate_reason
             = SDP_Solver_Terminate_Reason::MaxComplementarityExceeded;
           break;
         }
+
+      El::BigFloat beta_corrector;
+      step(parameters, total_psd_rows, is_primal_and_dual_feasible, block_info,
+           sdp, grid, Q_grid, X_cholesky, Y_cholesky,
+           bilinear_pairings_X_inv, bilinear_pairings_Y, primal_residue_p, mu,
+           beta_corrector, primal_step_length, dual_step_length, timers);
       print_iteration(iteration, mu, primal_step_length, dual_step_length,
                       beta_corrector, *this, solver_timer.start_time,
-                      parameters.verbosity);
+                      parameters.verbosity, block_info.solver_comm);
     }
   solver_timer.stop();
   return terminate_reason;
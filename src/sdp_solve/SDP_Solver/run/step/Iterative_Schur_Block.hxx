@@ -0,0 +1,80 @@
+#pragma once
+
+#include <El.hpp>
+
+#include <map>
+#include <vector>
+
+// A block S_j of the Schur complement matrix that is too large to
+// form and factor.  Instead, S_j is inverted with preconditioned
+// conjugate gradients.
+//
+// - By default, each (d_j+1)x(d_j+1) sub-block of S_j on or above
+//   the diagonal is computed from the bilinear pairings whenever it
+//   is needed, and discarded right after.  Only one sub-block is held
+//   at a time.
+// - With cache_sub_blocks, those sub-blocks are instead computed once,
+//   when this object is built, and reused by every product with S_j.
+//   This saves arithmetic, but holds about half of the memory of the
+//   full S_j for as long as this object lives.
+// - The preconditioner is block-Jacobi over the (r,s) sub-blocks.  It
+//   holds the Cholesky decompositions of the diagonal sub-blocks
+//   S_{(j,r,s,*),(j,r,s,*)}.
+// - If conjugate gradients does not converge, solve() prints a
+//   warning and falls back to assembling and factoring S_j.
+
+struct Iterative_Schur_Block
+{
+  // block_size = d_j+1, dimension = m_j
+  size_t block_size, dimension;
+
+  // The even and odd bilinear pairings for this block are at
+  // bilinear_pairings_X_inv and bilinear_pairings_X_inv+1.  Unless the
+  // sub-blocks are cached, they must outlive this object.
+  std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    bilinear_pairings_X_inv, bilinear_pairings_Y;
+
+  // Relative residual at which the conjugate gradient iterations stop
+  El::BigFloat tolerance;
+
+  // If cached, the sub-blocks on or above the diagonal of S_j.
+  // Sub-block rows are numbered p = s(s+1)/2 + r for r <= s.  The
+  // sub-blocks are stored row by row, (p0, p1) for
+  // p0 <= p1 < dimension(dimension+1)/2.  Empty if not cached.
+  std::vector<El::DistMatrix<El::BigFloat>> sub_blocks;
+
+  // One lower triangular block_size x block_size Cholesky factor for
+  // each diagonal sub-block, in the same order as the rows of S_j.
+  std::vector<El::DistMatrix<El::BigFloat>> preconditioner;
+
+  Iterative_Schur_Block(
+    const size_t &Block_size, const size_t &Dimension,
+    const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+      &Bilinear_pairings_X_inv,
+    const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+      &Bilinear_pairings_Y,
+    const El::BigFloat &Tolerance, const bool &cache_sub_blocks);
+
+  // The sub-block (p0, p1) with p0 = s0(s0+1)/2 + r0 and
+  // p1 = s1(s1+1)/2 + r1, which is sub-block number 'index' in row by
+  // row order.  Returns the cached sub-block if there is one, and
+  // otherwise computes it into 'result'.
+  const El::DistMatrix<El::BigFloat> &
+  sub_block(const size_t &index, const size_t &r0, const size_t &s0,
+            const size_t &r1, const size_t &s1,
+            El::DistMatrix<El::BigFloat> &temp,
+            El::DistMatrix<El::BigFloat> &result) const;
+
+  // result := S_j V.  result must have the same alignment as V.
+  void multiply(const El::DistMatrix<El::BigFloat> &V,
+                El::DistMatrix<El::BigFloat> &result) const;
+
+  // V := M^{-1} V, where M is the block-Jacobi preconditioner
+  void precondition(El::DistMatrix<El::BigFloat> &V) const;
+
+  // V := S_j^{-1} V, solving for every column of V at once
+  void solve(El::DistMatrix<El::BigFloat> &V) const;
+
+  // V := S_j^{-1} V with a Cholesky decomposition of the assembled S_j
+  void solve_dense(El::DistMatrix<El::BigFloat> &V) const;
+};
@@ -0,0 +1,64 @@
+#include "../Iterative_Schur_Block.hxx"
+
+void compute_schur_sub_block(
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_X_inv,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_Y,
+  const size_t &block_size, const size_t &row_block_0,
+  const size_t &column_block_0, const size_t &row_block_1,
+  const size_t &column_block_1, El::DistMatrix<El::BigFloat> &temp,
+  El::DistMatrix<El::BigFloat> &result);
+
+Iterative_Schur_Block::Iterative_Schur_Block(
+  const size_t &Block_size, const size_t &Dimension,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &Bilinear_pairings_X_inv,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &Bilinear_pairings_Y,
+  const El::BigFloat &Tolerance, const bool &cache_sub_blocks)
+    : block_size(Block_size), dimension(Dimension),
+      bilinear_pairings_X_inv(Bilinear_pairings_X_inv),
+      bilinear_pairings_Y(Bilinear_pairings_Y), tolerance(Tolerance)
+{
+  const El::Grid &grid(bilinear_pairings_X_inv->Grid());
+  El::DistMatrix<El::BigFloat> temp(block_size, block_size, grid);
+
+  const size_t num_sub_block_rows((dimension * (dimension + 1)) / 2);
+  preconditioner.reserve(num_sub_block_rows);
+  if(!cache_sub_blocks)
+    {
+      for(size_t column_block = 0; column_block < dimension; ++column_block)
+        for(size_t row_block = 0; row_block <= column_block; ++row_block)
+          {
+            preconditioner.emplace_back(block_size, block_size, grid);
+            compute_schur_sub_block(
+              bilinear_pairings_X_inv, bilinear_pairings_Y, block_size,
+              row_block, column_block, row_block, column_block, temp,
+              preconditioner.back());
+            Cholesky(El::UpperOrLowerNS::LOWER, preconditioner.back());
+          }
+      return;
+    }
+
+  sub_blocks.reserve((num_sub_block_rows * (num_sub_block_rows + 1)) / 2);
+  for(size_t column_block_0 = 0; column_block_0 < dimension; ++column_block_0)
+    for(size_t row_block_0 = 0; row_block_0 <= column_block_0; ++row_block_0)
+      for(size_t column_block_1 = column_block_0; column_block_1 < dimension;
+          ++column_block_1)
+        for(size_t row_block_1
+            = (column_block_1 == column_block_0 ? row_block_0 : 0);
+            row_block_1 <= column_block_1; ++row_block_1)
+          {
+            sub_blocks.emplace_back(block_size, block_size, grid);
+            compute_schur_sub_block(
+              bilinear_pairings_X_inv, bilinear_pairings_Y, block_size,
+              row_block_0, column_block_0, row_block_1, column_block_1, temp,
+              sub_blocks.back());
+            if(row_block_1 == row_block_0 && column_block_1 == column_block_0)
+              {
+                preconditioner.emplace_back(sub_blocks.back());
+                Cholesky(El::UpperOrLowerNS::LOWER, preconditioner.back());
+              }
+          }
+}
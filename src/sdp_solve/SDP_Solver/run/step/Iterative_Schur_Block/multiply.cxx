@@ -0,0 +1,62 @@
+#include "../Iterative_Schur_Block.hxx"
+
+// result := S_j V
+//
+// Each sub-block of S_j is applied to every column of V before moving
+// on to the next one.  S_j is symmetric, so only the sub-blocks on or
+// above the diagonal are used, and each one is used twice.  Unless
+// they are cached, each sub-block is computed from the bilinear
+// pairings when it is needed.
+
+void Iterative_Schur_Block::multiply(
+  const El::DistMatrix<El::BigFloat> &V,
+  El::DistMatrix<El::BigFloat> &result) const
+{
+  const int64_t width(V.Width());
+  El::Zeros(result, V.Height(), width);
+
+  El::DistMatrix<El::BigFloat> workspace(block_size, block_size, V.Grid()),
+    temp(block_size, block_size, V.Grid());
+
+  size_t index(0);
+  for(size_t column_block_0 = 0; column_block_0 < dimension; ++column_block_0)
+    for(size_t row_block_0 = 0; row_block_0 <= column_block_0; ++row_block_0)
+      {
+        const size_t offset_0(
+          ((column_block_0 * (column_block_0 + 1)) / 2 + row_block_0)
+          * block_size);
+        const El::DistMatrix<El::BigFloat> V_0(
+          El::LockedView(V, offset_0, 0, block_size, width));
+        El::DistMatrix<El::BigFloat> result_0(
+          El::View(result, offset_0, 0, block_size, width));
+
+        for(size_t column_block_1 = column_block_0;
+            column_block_1 < dimension; ++column_block_1)
+          for(size_t row_block_1
+              = (column_block_1 == column_block_0 ? row_block_0 : 0);
+              row_block_1 <= column_block_1; ++row_block_1)
+            {
+              const size_t offset_1(
+                ((column_block_1 * (column_block_1 + 1)) / 2 + row_block_1)
+                * block_size);
+              const El::DistMatrix<El::BigFloat> &S_sub_block(
+                sub_block(index, row_block_0, column_block_0, row_block_1,
+                          column_block_1, temp, workspace));
+              ++index;
+
+              const El::DistMatrix<El::BigFloat> V_1(
+                El::LockedView(V, offset_1, 0, block_size, width));
+              El::Gemm(El::OrientationNS::NORMAL, El::OrientationNS::NORMAL,
+                       El::BigFloat(1), S_sub_block, V_1, El::BigFloat(1),
+                       result_0);
+              if(offset_1 != offset_0)
+                {
+                  El::DistMatrix<El::BigFloat> result_1(
+                    El::View(result, offset_1, 0, block_size, width));
+                  El::Gemm(El::OrientationNS::TRANSPOSE,
+                           El::OrientationNS::NORMAL, El::BigFloat(1),
+                           S_sub_block, V_0, El::BigFloat(1), result_1);
+                }
+            }
+      }
+}
@@ -0,0 +1,18 @@
+#include "../Iterative_Schur_Block.hxx"
+
+// V := M^{-1} V, where M is the block-Jacobi preconditioner.  Each
+// group of block_size rows of V is solved with the Cholesky
+// decomposition of the matching diagonal sub-block of S_j.
+
+void Iterative_Schur_Block::precondition(El::DistMatrix<El::BigFloat> &V) const
+{
+  const int64_t width(V.Width());
+  for(size_t sub_block = 0; sub_block < preconditioner.size(); ++sub_block)
+    {
+      El::DistMatrix<El::BigFloat> V_sub_block(
+        El::View(V, sub_block * block_size, 0, block_size, width));
+      El::cholesky::SolveAfter(El::UpperOrLowerNS::LOWER,
+                               El::OrientationNS::NORMAL,
+                               preconditioner[sub_block], V_sub_block);
+    }
+}
@@ -0,0 +1,172 @@
+#include "../Iterative_Schur_Block.hxx"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+// V := S_j^{-1} V
+//
+// Preconditioned conjugate gradients, run on every column of V at
+// the same time.  Each column has its own step sizes, but the
+// products with S_j and the preconditioner are shared, and all of the
+// dot products in an iteration go into a single AllReduce.  A column
+// stops changing once its residual is below tolerance*|V_column|.
+//
+// If some column has not converged after V.Height() iterations,
+// rounding errors have stalled the iterations.  Rather than stopping
+// the run, we print a warning and solve with a Cholesky decomposition
+// of S_j instead.
+
+namespace
+{
+  // result[offset + column] += sum_i A(i,column) B(i,column) over the
+  // local elements.  A and B must have the same alignment.
+  void add_local_column_dots(const El::DistMatrix<El::BigFloat> &A,
+                             const El::DistMatrix<El::BigFloat> &B,
+                             const size_t &offset,
+                             std::vector<El::BigFloat> &result)
+  {
+    const El::Matrix<El::BigFloat> &A_local(A.LockedMatrix()),
+      &B_local(B.LockedMatrix());
+    for(int64_t column = 0; column < A.LocalWidth(); ++column)
+      {
+        El::BigFloat &dot(result[offset + A.GlobalCol(column)]);
+        for(int64_t row = 0; row < A.LocalHeight(); ++row)
+          {
+            dot += A_local(row, column) * B_local(row, column);
+          }
+      }
+  }
+
+  // A(:,column) := A(:,column) + scale[column] B(:,column)
+  void add_scaled_columns(const std::vector<El::BigFloat> &scale,
+                          const El::DistMatrix<El::BigFloat> &B,
+                          El::DistMatrix<El::BigFloat> &A)
+  {
+    El::Matrix<El::BigFloat> &A_local(A.Matrix());
+    const El::Matrix<El::BigFloat> &B_local(B.LockedMatrix());
+    for(int64_t column = 0; column < A.LocalWidth(); ++column)
+      {
+        const El::BigFloat &s(scale[A.GlobalCol(column)]);
+        for(int64_t row = 0; row < A.LocalHeight(); ++row)
+          {
+            A_local(row, column) += s * B_local(row, column);
+          }
+      }
+  }
+
+  // A(:,column) := B(:,column) + scale[column] A(:,column)
+  void scale_columns_and_add(const std::vector<El::BigFloat> &scale,
+                             const El::DistMatrix<El::BigFloat> &B,
+                             El::DistMatrix<El::BigFloat> &A)
+  {
+    El::Matrix<El::BigFloat> &A_local(A.Matrix());
+    const El::Matrix<El::BigFloat> &B_local(B.LockedMatrix());
+    for(int64_t column = 0; column < A.LocalWidth(); ++column)
+      {
+        const El::BigFloat &s(scale[A.GlobalCol(column)]);
+        for(int64_t row = 0; row < A.LocalHeight(); ++row)
+          {
+            A_local(row, column)
+              = B_local(row, column) + s * A_local(row, column);
+          }
+      }
+  }
+}
+
+void Iterative_Schur_Block::solve(El::DistMatrix<El::BigFloat> &V) const
+{
+  const size_t width(V.Width());
+  const El::BigFloat zero(0), tolerance_squared(tolerance * tolerance);
+
+  // Start from zero, so the initial residual is V.  Copying V keeps
+  // the alignments of all of the matrices the same.
+  const El::DistMatrix<El::BigFloat> rhs(V);
+  El::DistMatrix<El::BigFloat> residual(V), preconditioned(V), direction(V),
+    S_direction(V);
+  El::Zero(V);
+  precondition(preconditioned);
+  El::Copy(preconditioned, direction);
+
+  // dots = (|V|^2, residual.preconditioned) for every column
+  std::vector<El::BigFloat> dots(2 * width, zero);
+  add_local_column_dots(residual, residual, 0, dots);
+  add_local_column_dots(residual, preconditioned, width, dots);
+  El::mpi::AllReduce(dots.data(), dots.size(), El::mpi::SUM, V.DistComm());
+
+  const std::vector<El::BigFloat> rhs_norm_squared(dots.begin(),
+                                                   dots.begin() + width);
+  std::vector<El::BigFloat> residual_dot(dots.begin() + width, dots.end()),
+    alpha(width), beta(width), direction_dot(width);
+  std::vector<bool> converged(width);
+  for(size_t column = 0; column < width; ++column)
+    {
+      converged[column] = (rhs_norm_squared[column] == zero);
+    }
+
+  // In exact arithmetic, conjugate gradients converges in at most
+  // V.Height() steps.
+  const int64_t max_iterations(V.Height());
+  for(int64_t iteration = 0;
+      std::find(converged.begin(), converged.end(), false) != converged.end();
+      ++iteration)
+    {
+      if(iteration == max_iterations)
+        {
+          if(El::mpi::Rank(V.DistComm()) == 0)
+            {
+              std::stringstream ss;
+              ss << "Warning: conjugate gradients for a block of the Schur "
+                 << "complement did not converge after " << max_iterations
+                 << " iterations.  Falling back to a Cholesky "
+                 << "decomposition of the block.\n";
+              std::cerr << ss.str() << std::flush;
+            }
+          El::Copy(rhs, V);
+          solve_dense(V);
+          return;
+        }
+      multiply(direction, S_direction);
+
+      std::fill(direction_dot.begin(), direction_dot.end(), zero);
+      add_local_column_dots(direction, S_direction, 0, direction_dot);
+      El::mpi::AllReduce(direction_dot.data(), direction_dot.size(),
+                         El::mpi::SUM, V.DistComm());
+
+      for(size_t column = 0; column < width; ++column)
+        {
+          alpha[column] = converged[column]
+                            ? zero
+                            : residual_dot[column] / direction_dot[column];
+        }
+      add_scaled_columns(alpha, direction, V);
+      for(auto &a : alpha)
+        {
+          a = -a;
+        }
+      add_scaled_columns(alpha, S_direction, residual);
+
+      El::Copy(residual, preconditioned);
+      precondition(preconditioned);
+
+      std::fill(dots.begin(), dots.end(), zero);
+      add_local_column_dots(residual, residual, 0, dots);
+      add_local_column_dots(residual, preconditioned, width, dots);
+      El::mpi::AllReduce(dots.data(), dots.size(), El::mpi::SUM,
+                         V.DistComm());
+
+      for(size_t column = 0; column < width; ++column)
+        {
+          if(converged[column])
+            {
+              beta[column] = zero;
+              continue;
+            }
+          beta[column] = dots[width + column] / residual_dot[column];
+          residual_dot[column] = dots[width + column];
+          converged[column]
+            = (dots[column] <= tolerance_squared * rhs_norm_squared[column]);
+        }
+      scale_columns_and_add(beta, preconditioned, direction);
+    }
+}
@@ -0,0 +1,52 @@
+#include "../Iterative_Schur_Block.hxx"
+
+// V := S_j^{-1} V
+//
+// The fallback when conjugate gradients does not converge.  S_j is
+// assembled from its sub-blocks on or above the diagonal, using the
+// symmetry for the sub-blocks below the diagonal, and then factored.
+// The assembled S_j only lives for the duration of this call.
+
+void Iterative_Schur_Block::solve_dense(El::DistMatrix<El::BigFloat> &V) const
+{
+  El::DistMatrix<El::BigFloat> S(V.Height(), V.Height(), V.Grid()),
+    workspace(block_size, block_size, V.Grid()),
+    temp(block_size, block_size, V.Grid());
+
+  size_t index(0);
+  for(size_t column_block_0 = 0; column_block_0 < dimension; ++column_block_0)
+    for(size_t row_block_0 = 0; row_block_0 <= column_block_0; ++row_block_0)
+      {
+        const size_t offset_0(
+          ((column_block_0 * (column_block_0 + 1)) / 2 + row_block_0)
+          * block_size);
+        for(size_t column_block_1 = column_block_0;
+            column_block_1 < dimension; ++column_block_1)
+          for(size_t row_block_1
+              = (column_block_1 == column_block_0 ? row_block_0 : 0);
+              row_block_1 <= column_block_1; ++row_block_1)
+            {
+              const size_t offset_1(
+                ((column_block_1 * (column_block_1 + 1)) / 2 + row_block_1)
+                * block_size);
+              const El::DistMatrix<El::BigFloat> &S_sub_block(
+                sub_block(index, row_block_0, column_block_0, row_block_1,
+                          column_block_1, temp, workspace));
+              ++index;
+
+              El::DistMatrix<El::BigFloat> S_upper(El::View(
+                S, offset_0, offset_1, block_size, block_size));
+              El::Copy(S_sub_block, S_upper);
+              if(offset_1 != offset_0)
+                {
+                  El::DistMatrix<El::BigFloat> S_lower(El::View(
+                    S, offset_1, offset_0, block_size, block_size));
+                  El::Transpose(S_sub_block, S_lower);
+                }
+            }
+      }
+
+  Cholesky(El::UpperOrLowerNS::LOWER, S);
+  El::cholesky::SolveAfter(El::UpperOrLowerNS::LOWER,
+                           El::OrientationNS::NORMAL, S, V);
+}
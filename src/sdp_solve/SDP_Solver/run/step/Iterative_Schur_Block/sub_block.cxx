@@ -0,0 +1,25 @@
+#include "../Iterative_Schur_Block.hxx"
+
+void compute_schur_sub_block(
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_X_inv,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_Y,
+  const size_t &block_size, const size_t &row_block_0,
+  const size_t &column_block_0, const size_t &row_block_1,
+  const size_t &column_block_1, El::DistMatrix<El::BigFloat> &temp,
+  El::DistMatrix<El::BigFloat> &result);
+
+const El::DistMatrix<El::BigFloat> &Iterative_Schur_Block::sub_block(
+  const size_t &index, const size_t &r0, const size_t &s0, const size_t &r1,
+  const size_t &s1, El::DistMatrix<El::BigFloat> &temp,
+  El::DistMatrix<El::BigFloat> &result) const
+{
+  if(!sub_blocks.empty())
+    {
+      return sub_blocks[index];
+    }
+  compute_schur_sub_block(bilinear_pairings_X_inv, bilinear_pairings_Y,
+                          block_size, r0, s0, r1, s1, temp, result);
+  return result;
+}
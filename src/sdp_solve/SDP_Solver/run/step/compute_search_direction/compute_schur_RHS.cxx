@@ -1,5 +1,7 @@
 #include "../../../../SDP_Solver.hxx"
 
+#include <algorithm>
+
 // Compute the vector r_x on the right-hand side of the Schur
 // complement equation:
 //
@@ -17,6 +19,13 @@
 // - Z = X^{-1} (PrimalResidues Y - R)
 // Outputs:
 // - r_x, a Vector of length P
+//
+// Tr(A_(j,r,s,k) Z) = v_{b,k}^T Z^{(r,s)} v_{b,k} summed over b, where
+// Z^{(r,s)} is the (r,s) sub-block of Z.  These quadratic forms are
+// computed for every k in one pass over the local elements of Z, using
+// the replicated copy of the bilinear bases, so no temporary matrices
+// are needed.  The partial sums from both parities are then combined
+// with one AllReduce per block.
 
 void compute_schur_RHS(const Block_Info &block_info, const SDP &sdp,
                        const Block_Vector &dual_residues,
@@ -27,58 +36,82 @@ void compute_schur_RHS(const Block_Info &block_info, const SDP &sdp,
   auto dx_block(dx.blocks.begin());
 
   auto Z_block(Z.blocks.begin());
-  auto bilinear_bases_block(sdp.bilinear_bases_dist.begin());
+  auto bilinear_bases_block(sdp.bilinear_bases_local.begin());
 
+  const El::BigFloat zero(0);
   for(auto &block_index : block_info.block_indices)
     {
-      // dx = -dual_residues
-      *dx_block = *dual_residues_block;
-      *dx_block *= -1;
-      const size_t dx_block_size(block_info.degrees[block_index] + 1);
+      const size_t dx_block_size(block_info.degrees[block_index] + 1),
+        dimension(block_info.dimensions[block_index]);
 
-      // dx[p] -= Tr(A_p Z)
-      // Not sure whether it is better to first loop over blocks in
-      // the result or over sub-blocks in Z
+      // trace[p] = Tr(A_p Z), with p = (r,s,k) in the same order as dx
+      std::vector<El::BigFloat> trace(dx_block->Height(), zero),
+        column_sums(dimension * dx_block_size);
       for(size_t parity = 0; parity < 2; ++parity)
         {
-          const size_t Z_block_size(bilinear_bases_block->Height());
-          El::DistMatrix<El::BigFloat> ones(Z_block->Grid());
-          El::Ones(ones, Z_block_size, 1);
-
-          for(size_t column_block = 0;
-              column_block < block_info.dimensions[block_index];
-              ++column_block)
-            for(size_t row_block = 0; row_block <= column_block; ++row_block)
-              {
-                size_t column_offset(column_block * Z_block_size),
-                  row_offset(row_block * Z_block_size);
-
-                El::DistMatrix<El::BigFloat> Z_sub_block(
-                  El::LockedView(*Z_block, row_offset, column_offset,
-                                 Z_block_size, Z_block_size)),
-                  Z_times_q(Z_block_size, dx_block_size, Z_block->Grid());
-                El::Zero(Z_times_q);
-                El::DistMatrix<El::BigFloat> q_Z_q(Z_times_q);
-                El::Zero(q_Z_q);
-
-                El::Gemm(El::Orientation::NORMAL, El::Orientation::NORMAL,
-                         El::BigFloat(1), Z_sub_block, *bilinear_bases_block,
-                         El::BigFloat(0), Z_times_q);
+          const El::Matrix<El::BigFloat> &bases(*bilinear_bases_block);
+          const size_t Z_block_size(bases.Height());
+          const El::Matrix<El::BigFloat> &Z_local(Z_block->LockedMatrix());
+          for(int64_t local_column = 0; local_column < Z_block->LocalWidth();
+              ++local_column)
+            {
+              const size_t global_column(Z_block->GlobalCol(local_column)),
+                column_block(global_column / Z_block_size),
+                column(global_column % Z_block_size);
 
-                El::Hadamard(Z_times_q, *bilinear_bases_block, q_Z_q);
+              // column_sums[row_block, k] = \sum_row Z(row, column) v_k(row)
+              std::fill(column_sums.begin(),
+                        column_sums.begin()
+                          + (column_block + 1) * dx_block_size,
+                        zero);
+              for(int64_t local_row = 0; local_row < Z_block->LocalHeight();
+                  ++local_row)
+                {
+                  const size_t global_row(Z_block->GlobalRow(local_row)),
+                    row_block(global_row / Z_block_size),
+                    row(global_row % Z_block_size);
+                  if(row_block > column_block)
+                    {
+                      continue;
+                    }
+                  const El::BigFloat &z(Z_local(local_row, local_column));
+                  for(size_t k = 0; k < dx_block_size; ++k)
+                    {
+                      column_sums[row_block * dx_block_size + k]
+                        += z * bases(row, k);
+                    }
+                }
 
-                const size_t dx_row_offset(
-                  ((column_block * (column_block + 1)) / 2 + row_block)
-                  * dx_block_size);
-                El::DistMatrix<El::BigFloat> dx_sub_block(
-                  El::View(*dx_block, dx_row_offset, 0, dx_block_size, 1));
-
-                El::Gemv(El::Orientation::TRANSPOSE, El::BigFloat(-1), q_Z_q,
-                         ones, El::BigFloat(1), dx_sub_block);
-              }
+              for(size_t row_block = 0; row_block <= column_block; ++row_block)
+                {
+                  const size_t dx_row_offset(
+                    ((column_block * (column_block + 1)) / 2 + row_block)
+                    * dx_block_size);
+                  for(size_t k = 0; k < dx_block_size; ++k)
+                    {
+                      trace[dx_row_offset + k]
+                        += column_sums[row_block * dx_block_size + k]
+                           * bases(column, k);
+                    }
+                }
+            }
           ++Z_block;
           ++bilinear_bases_block;
         }
+      El::mpi::AllReduce(trace.data(), trace.size(), El::mpi::SUM,
+                         dx_block->DistComm());
+
+      // dx = -dual_residues - Tr(A_p Z)
+      *dx_block = *dual_residues_block;
+      El::Matrix<El::BigFloat> &dx_local(dx_block->Matrix());
+      for(int64_t row = 0; row < dx_block->LocalHeight(); ++row)
+        {
+          const El::BigFloat &trace_p(trace[dx_block->GlobalRow(row)]);
+          for(int64_t column = 0; column < dx_block->LocalWidth(); ++column)
+            {
+              dx_local(row, column) = -dx_local(row, column) - trace_p;
+            }
+        }
 
       ++dual_residues_block;
       ++dx_block;
@@ -1,3 +1,4 @@
+#include "../Iterative_Schur_Block.hxx"
 #include "../../constraint_matrix_weighted_sum.hxx"
 #include "../../../../../Timers.hxx"
 
@@ -39,18 +40,22 @@ void compute_schur_RHS(const Block_Info &block_info, const SDP &sdp,
                        Block_Vector &dx);
 
 void solve_schur_complement_equation(
-  const Block_Diagonal_Matrix &schur_complement_cholesky,
+  const SDP &sdp, const Block_Diagonal_Matrix &schur_complement_cholesky,
   const Block_Matrix &schur_off_diagonal,
-  const El::DistMatrix<El::BigFloat> &Q, Block_Vector &dx, Block_Vector &dy);
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const El::DistMatrix<El::BigFloat> &Q, const El::BigFloat &tolerance,
+  const El::mpi::Comm &comm, Block_Vector &dx, Block_Vector &dy);
 
 void compute_search_direction(
   const Block_Info &block_info, const SDP &sdp, const SDP_Solver &solver,
   const Block_Diagonal_Matrix &schur_complement_cholesky,
   const Block_Matrix &schur_off_diagonal,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
   const Block_Diagonal_Matrix &X_cholesky, const El::BigFloat beta,
   const El::BigFloat &mu, const Block_Vector &primal_residue_p,
   const bool &is_corrector_phase,
-  const El::DistMatrix<El::BigFloat> &Q, Block_Vector &dx,
+  const El::DistMatrix<El::BigFloat> &Q,
+  const El::BigFloat &iterative_tolerance, Block_Vector &dx,
   Block_Diagonal_Matrix &dX, Block_Vector &dy, Block_Diagonal_Matrix &dY)
 {
   // R = beta mu I - X Y (predictor phase)
@@ -77,8 +82,10 @@ void compute_search_direction(
   dy=primal_residue_p;
 
   // Solve for dx, dy in-place
-  solve_schur_complement_equation(schur_complement_cholesky,
-                                  schur_off_diagonal, Q, dx, dy);
+  solve_schur_complement_equation(sdp, schur_complement_cholesky,
+                                  schur_off_diagonal, iterative_schur_blocks,
+                                  Q, iterative_tolerance,
+                                  block_info.solver_comm, dx, dy);
 
   // dX = PrimalResidues + \sum_p A_p dx[p]
   constraint_matrix_weighted_sum(block_info, sdp, dx, dX);
@@ -0,0 +1,242 @@
+#include "../Iterative_Schur_Block.hxx"
+#include "../../../../SDP.hxx"
+#include "../../../../Block_Vector.hxx"
+
+#include <iostream>
+#include <sstream>
+
+// dy := Q^{-1} dy, without ever forming Q.
+//
+//   Q = \sum_j SchurOffDiagonal_j^T SchurOffDiagonal_j
+//
+// or B_j^T SchurOffDiagonal_j for blocks that are solved iteratively
+// (see Iterative_Schur_Block).  dy is replicated on every process, so
+// the conjugate gradient updates are done redundantly everywhere, and
+// each product with Q is two Gemv's per block followed by a single
+// AllReduce in sum_over_blocks.  The preconditioner is the diagonal of
+// Q, which only needs the column norms of SchurOffDiagonal.
+//
+// Each block only stores the columns of B starting at
+// free_var_column_offsets, so it only touches those rows of v and Q v.
+//
+// If conjugate gradients does not converge, we print a warning and
+// fall back to forming Q on every process and solving with its
+// Cholesky decomposition.  This needs height^2 BigFloats per process,
+// but only for the steps where the iterations stall.
+
+void sum_over_blocks(const Block_Vector &v, const int64_t &height,
+                     const El::mpi::Comm &comm,
+                     El::Matrix<El::BigFloat> &result);
+
+namespace
+{
+  // result := Q v
+  void multiply_Q(
+    const SDP &sdp, const Block_Matrix &schur_off_diagonal,
+    const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+    const El::Matrix<El::BigFloat> &v, const El::mpi::Comm &comm,
+    El::Matrix<El::BigFloat> &result)
+  {
+    const int64_t height(v.Height());
+    Block_Vector Q_v;
+    Q_v.blocks.reserve(schur_off_diagonal.blocks.size());
+    for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+      {
+        const El::DistMatrix<El::BigFloat> &off_diagonal(
+          schur_off_diagonal.blocks[block]);
+        Q_v.blocks.emplace_back(height, 1, off_diagonal.Grid());
+        El::Zero(Q_v.blocks.back());
+        if(off_diagonal.Width() == 0)
+          {
+            continue;
+          }
+
+        const int64_t offset(sdp.free_var_column_offsets[block]);
+        El::DistMatrix<El::BigFloat> v_dist(off_diagonal.Width(), 1,
+                                            off_diagonal.Grid());
+        El::Matrix<El::BigFloat> &v_local(v_dist.Matrix());
+        for(int64_t row = 0; row < v_dist.LocalHeight(); ++row)
+          for(int64_t column = 0; column < v_dist.LocalWidth(); ++column)
+            {
+              v_local(row, column) = v(offset + v_dist.GlobalRow(row),
+                                       v_dist.GlobalCol(column));
+            }
+
+        El::DistMatrix<El::BigFloat> off_diagonal_v(off_diagonal.Height(), 1,
+                                                    off_diagonal.Grid());
+        El::Gemv(El::OrientationNS::NORMAL, El::BigFloat(1), off_diagonal,
+                 v_dist, El::BigFloat(0), off_diagonal_v);
+
+        El::DistMatrix<El::BigFloat> Q_v_columns(El::View(
+          Q_v.blocks.back(), offset, 0, off_diagonal.Width(), 1));
+        El::Gemv(El::OrientationNS::TRANSPOSE, El::BigFloat(1),
+                 iterative_schur_blocks.count(block) == 0
+                   ? off_diagonal
+                   : sdp.free_var_matrix.blocks[block],
+                 off_diagonal_v, El::BigFloat(0), Q_v_columns);
+      }
+    sum_over_blocks(Q_v, height, comm, result);
+  }
+
+  // diagonal = diag(Q)
+  void Q_diagonal(
+    const SDP &sdp, const Block_Matrix &schur_off_diagonal,
+    const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+    const int64_t &height, const El::mpi::Comm &comm,
+    El::Matrix<El::BigFloat> &diagonal)
+  {
+    El::Zeros(diagonal, height, 1);
+    for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+      {
+        const El::DistMatrix<El::BigFloat> &off_diagonal(
+          schur_off_diagonal.blocks[block]),
+          &left(iterative_schur_blocks.count(block) == 0
+                  ? off_diagonal
+                  : sdp.free_var_matrix.blocks[block]);
+        const El::Matrix<El::BigFloat> &off_diagonal_local(
+          off_diagonal.LockedMatrix()),
+          &left_local(left.LockedMatrix());
+        for(int64_t column = 0; column < off_diagonal.LocalWidth(); ++column)
+          {
+            El::BigFloat &element(
+              diagonal(sdp.free_var_column_offsets[block]
+                         + off_diagonal.GlobalCol(column),
+                       0));
+            for(int64_t row = 0; row < off_diagonal.LocalHeight(); ++row)
+              {
+                element += left_local(row, column)
+                           * off_diagonal_local(row, column);
+              }
+          }
+      }
+    El::AllReduce(diagonal, comm);
+
+    // Do not scale free variables that do not appear in any block.
+    const El::BigFloat zero(0);
+    for(int64_t row = 0; row < height; ++row)
+      {
+        if(diagonal(row, 0) == zero)
+          {
+            diagonal(row, 0) = 1;
+          }
+      }
+  }
+
+  // Q, replicated on every process.  Each block computes its
+  // contribution on its own grid, and every element is added in by the
+  // process that owns it.
+  void form_Q(
+    const SDP &sdp, const Block_Matrix &schur_off_diagonal,
+    const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+    const int64_t &height, const El::mpi::Comm &comm,
+    El::Matrix<El::BigFloat> &Q)
+  {
+    El::Zeros(Q, height, height);
+    for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+      {
+        const El::DistMatrix<El::BigFloat> &off_diagonal(
+          schur_off_diagonal.blocks[block]),
+          &left(iterative_schur_blocks.count(block) == 0
+                  ? off_diagonal
+                  : sdp.free_var_matrix.blocks[block]);
+        if(off_diagonal.Width() == 0)
+          {
+            continue;
+          }
+
+        El::DistMatrix<El::BigFloat> Q_block(
+          off_diagonal.Width(), off_diagonal.Width(), off_diagonal.Grid());
+        El::Gemm(El::OrientationNS::TRANSPOSE, El::OrientationNS::NORMAL,
+                 El::BigFloat(1), left, off_diagonal, El::BigFloat(0),
+                 Q_block);
+
+        const int64_t offset(sdp.free_var_column_offsets[block]);
+        const El::Matrix<El::BigFloat> &Q_block_local(
+          Q_block.LockedMatrix());
+        for(int64_t column = 0; column < Q_block.LocalWidth(); ++column)
+          for(int64_t row = 0; row < Q_block.LocalHeight(); ++row)
+            {
+              Q(offset + Q_block.GlobalRow(row),
+                offset + Q_block.GlobalCol(column))
+                += Q_block_local(row, column);
+            }
+      }
+    El::AllReduce(Q, comm);
+  }
+}
+
+void solve_Q_iteratively(
+  const SDP &sdp, const Block_Matrix &schur_off_diagonal,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const El::BigFloat &tolerance, const El::mpi::Comm &comm,
+  El::Matrix<El::BigFloat> &dy)
+{
+  const int64_t height(dy.Height());
+
+  El::Matrix<El::BigFloat> diagonal;
+  Q_diagonal(sdp, schur_off_diagonal, iterative_schur_blocks, height, comm,
+             diagonal);
+
+  // Start from zero, so the initial residual is dy.
+  const El::Matrix<El::BigFloat> rhs(dy);
+  El::Matrix<El::BigFloat> residual(dy), preconditioned(height, 1),
+    direction(height, 1), Q_direction;
+  El::Zero(dy);
+  for(int64_t row = 0; row < height; ++row)
+    {
+      preconditioned(row, 0) = residual(row, 0) / diagonal(row, 0);
+    }
+  El::Copy(preconditioned, direction);
+
+  const El::BigFloat rhs_norm_squared(El::Dot(residual, residual)),
+    tolerance_squared(tolerance * tolerance);
+  El::BigFloat residual_norm_squared(rhs_norm_squared),
+    residual_dot(El::Dot(residual, preconditioned));
+
+  // In exact arithmetic, conjugate gradients converges in at most
+  // 'height' steps.
+  for(int64_t iteration = 0;
+      residual_norm_squared > tolerance_squared * rhs_norm_squared;
+      ++iteration)
+    {
+      if(iteration == height)
+        {
+          if(El::mpi::Rank(comm) == 0)
+            {
+              std::stringstream ss;
+              ss << "Warning: conjugate gradients for Q did not converge "
+                 << "after " << height << " iterations.  Falling back to "
+                 << "forming Q and computing its Cholesky decomposition.\n";
+              std::cerr << ss.str() << std::flush;
+            }
+          El::Matrix<El::BigFloat> Q;
+          form_Q(sdp, schur_off_diagonal, iterative_schur_blocks, height,
+                 comm, Q);
+          El::Cholesky(El::UpperOrLowerNS::LOWER, Q);
+          dy = rhs;
+          El::cholesky::SolveAfter(El::UpperOrLowerNS::LOWER,
+                                   El::OrientationNS::NORMAL, Q, dy);
+          return;
+        }
+      multiply_Q(sdp, schur_off_diagonal, iterative_schur_blocks,
+                 direction, comm, Q_direction);
+
+      const El::BigFloat alpha(residual_dot
+                               / El::Dot(direction, Q_direction));
+      El::Axpy(alpha, direction, dy);
+      El::Axpy(-alpha, Q_direction, residual);
+
+      for(int64_t row = 0; row < height; ++row)
+        {
+          preconditioned(row, 0) = residual(row, 0) / diagonal(row, 0);
+        }
+      const El::BigFloat new_residual_dot(El::Dot(residual, preconditioned));
+      const El::BigFloat beta(new_residual_dot / residual_dot);
+      residual_dot = new_residual_dot;
+      residual_norm_squared = El::Dot(residual, residual);
+
+      // direction = preconditioned + beta direction
+      direction *= beta;
+      direction += preconditioned;
+    }
+}
@@ -1,6 +1,15 @@
-#include "lower_triangular_solve.hxx"
+#include "../Iterative_Schur_Block.hxx"
 #include "../../../../SDP_Solver.hxx"
-#include "../../../../lower_triangular_transpose_solve.hxx"
+
+void sum_over_blocks(const Block_Vector &v, const int64_t &height,
+                     const El::mpi::Comm &comm,
+                     El::Matrix<El::BigFloat> &result);
+
+void solve_Q_iteratively(
+  const SDP &sdp, const Block_Matrix &schur_off_diagonal,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const El::BigFloat &tolerance, const El::mpi::Comm &comm,
+  El::Matrix<El::BigFloat> &dy);
 
 // Solve the Schur complement equation for dx, dy.
 //
@@ -10,80 +19,151 @@
 //   Schur complement equation.
 //
 // The equation is solved using the block-decomposition described in
-// the manual.
+// the manual.  For blocks that are solved iteratively,
+// SchurOffDiagonal = S^{-1} B, so
+//
+//   B^T S^{-1} dx = SchurOffDiagonal^T dx
+//
+// and dx is replaced by S^{-1} dx directly.
+//
+// If Q is empty, it was never formed, and Q dy = r_y is solved with
+// conjugate gradients instead (see solve_Q_iteratively).
+//
+// If a block of SchurOffDiagonal is empty, it was freed to save
+// memory (see recomputeSchurOffDiagonal).  Products with it are
+// recomputed from B with
+//
+//   SchurOffDiagonal^T v = B^T L^{-T} v
+//   SchurOffDiagonal v   = L^{-1} B v
 //
 void solve_schur_complement_equation(
-  const Block_Diagonal_Matrix &schur_complement_cholesky,
+  const SDP &sdp, const Block_Diagonal_Matrix &schur_complement_cholesky,
   const Block_Matrix &schur_off_diagonal,
-  const El::DistMatrix<El::BigFloat> &Q, Block_Vector &dx, Block_Vector &dy)
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const El::DistMatrix<El::BigFloat> &Q, const El::BigFloat &tolerance,
+  const El::mpi::Comm &comm, Block_Vector &dx, Block_Vector &dy)
 {
-  // Set dx to SchurComplementCholesky^{-1} dx
-  lower_triangular_solve(schur_complement_cholesky, dx);
-
-  El::DistMatrix<El::BigFloat> dy_dist;
-  Zeros(dy_dist, Q.Height(), 1);
-  {
-    El::Matrix<El::BigFloat> dy_sum;
-    Zeros(dy_sum, Q.Height(), 1);
-
-    for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
-      {
-        Gemv(El::OrientationNS::TRANSPOSE, El::BigFloat(-1),
-             schur_off_diagonal.blocks[block], dx.blocks[block],
-             El::BigFloat(1), dy.blocks[block]);
-
-        // Locally sum contributions to dy
-        for(int64_t row = 0; row < dy.blocks[block].LocalHeight(); ++row)
-          {
-            int64_t global_row(dy.blocks[block].GlobalRow(row));
-            for(int64_t column = 0; column < dy.blocks[block].LocalWidth();
-                ++column)
-              {
-                int64_t global_column(dy.blocks[block].GlobalCol(column));
-                dy_sum(global_row, global_column)
-                  += dy.blocks[block].GetLocal(row, column);
-              }
-          }
-      }
+  for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+    {
+      auto iterative_block(iterative_schur_blocks.find(block));
+      if(iterative_block == iterative_schur_blocks.end())
+        {
+          // Set dx to SchurComplementCholesky^{-1} dx
+          El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+                   El::OrientationNS::NORMAL, El::UnitOrNonUnitNS::NON_UNIT,
+                   El::BigFloat(1), schur_complement_cholesky.blocks[block],
+                   dx.blocks[block]);
+        }
+      // Only the stored columns of B contribute to dy.
+      El::DistMatrix<El::BigFloat> dy_columns(El::View(
+        dy.blocks[block], sdp.free_var_column_offsets[block], 0,
+        sdp.free_var_matrix.blocks[block].Width(), 1));
+      if(dy_columns.Height() != 0)
+        {
+          if(schur_off_diagonal.blocks[block].Height() == 0)
+            {
+              El::DistMatrix<El::BigFloat> L_T_dx(dx.blocks[block]);
+              El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+                       El::OrientationNS::TRANSPOSE, El::UnitOrNonUnitNS::NON_UNIT,
+                       El::BigFloat(1), schur_complement_cholesky.blocks[block],
+                       L_T_dx);
+              Gemv(El::OrientationNS::TRANSPOSE, El::BigFloat(-1),
+                   sdp.free_var_matrix.blocks[block], L_T_dx, El::BigFloat(1),
+                   dy_columns);
+            }
+          else
+            {
+              Gemv(El::OrientationNS::TRANSPOSE, El::BigFloat(-1),
+                   schur_off_diagonal.blocks[block], dx.blocks[block],
+                   El::BigFloat(1), dy_columns);
+            }
+        }
+      if(iterative_block != iterative_schur_blocks.end())
+        {
+          // Set dx to S^{-1} dx
+          iterative_block->second.solve(dx.blocks[block]);
+        }
+    }
 
-    // Send out updates for dy
-    El::BigFloat zero(0);
-    for(int64_t row = 0; row < dy_sum.Height(); ++row)
-      for(int64_t column = 0; column < dy_sum.Width(); ++column)
+  // Every process gets the complete sum of dy, so each process can
+  // fill in its part of dy_dist, whatever the layout of Q.
+  El::Matrix<El::BigFloat> dy_solution;
+  sum_over_blocks(dy, sdp.dual_objective_b.Height(), comm, dy_solution);
+  if(Q.Height() == 0)
+    {
+      solve_Q_iteratively(sdp, schur_off_diagonal,
+                          iterative_schur_blocks, tolerance, comm,
+                          dy_solution);
+    }
+  else
+    {
+      El::DistMatrix<El::BigFloat> dy_dist(Q.Height(), 1, Q.Grid());
+      El::Matrix<El::BigFloat> &dy_dist_local(dy_dist.Matrix());
+      for(int64_t row = 0; row < dy_dist.LocalHeight(); ++row)
         {
-          if(dy_sum(row, column)!=zero)
+          const int64_t global_row(dy_dist.GlobalRow(row));
+          for(int64_t column = 0; column < dy_dist.LocalWidth(); ++column)
             {
-              dy_dist.QueueUpdate(row, column, dy_sum(row, column));
+              dy_dist_local(row, column)
+                = dy_solution(global_row, dy_dist.GlobalCol(column));
             }
         }
-  }
-  dy_dist.ProcessQueues();
 
-  // Set dy_dist to Q^{-1} dy_dist
-  El::cholesky::SolveAfter(El::UpperOrLowerNS::UPPER,
-                           El::OrientationNS::NORMAL, Q, dy_dist);
-  El::DistMatrix<El::BigFloat, El::STAR, El::STAR> dy_local(dy_dist);
+      // Set dy_dist to Q^{-1} dy_dist
+      El::cholesky::SolveAfter(El::UpperOrLowerNS::UPPER,
+                               El::OrientationNS::NORMAL, Q, dy_dist);
+      El::DistMatrix<El::BigFloat, El::STAR, El::STAR> dy_local(dy_dist);
+      dy_solution = dy_local.LockedMatrix();
+    }
 
   // dx += SchurOffDiagonal dy
   for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
     {
+      El::Matrix<El::BigFloat> &dy_block(dy.blocks[block].Matrix());
       for(int64_t row = 0; row < dy.blocks[block].LocalHeight(); ++row)
         {
-          int64_t global_row(dy.blocks[block].GlobalRow(row));
-
+          const int64_t global_row(dy.blocks[block].GlobalRow(row));
           for(int64_t column = 0; column < dy.blocks[block].LocalWidth();
               ++column)
             {
-              int64_t global_column(dy.blocks[block].GlobalCol(column));
-              dy.blocks[block].SetLocal(
-                row, column, dy_local.GetLocal(global_row, global_column));
+              dy_block(row, column) = dy_solution(
+                global_row, dy.blocks[block].GlobalCol(column));
+            }
+        }
+      const El::DistMatrix<El::BigFloat> dy_columns(El::LockedView(
+        dy.blocks[block], sdp.free_var_column_offsets[block], 0,
+        sdp.free_var_matrix.blocks[block].Width(), 1));
+      if(dy_columns.Height() != 0)
+        {
+          if(schur_off_diagonal.blocks[block].Height() == 0)
+            {
+              El::DistMatrix<El::BigFloat> L_inv_B_dy(
+                sdp.free_var_matrix.blocks[block].Height(), 1,
+                dx.blocks[block].Grid());
+              Gemv(El::OrientationNS::NORMAL, El::BigFloat(1),
+                   sdp.free_var_matrix.blocks[block], dy_columns,
+                   El::BigFloat(0), L_inv_B_dy);
+              El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+                       El::OrientationNS::NORMAL, El::UnitOrNonUnitNS::NON_UNIT,
+                       El::BigFloat(1), schur_complement_cholesky.blocks[block],
+                       L_inv_B_dy);
+              El::Axpy(El::BigFloat(1), L_inv_B_dy, dx.blocks[block]);
+            }
+          else
+            {
+              Gemv(El::OrientationNS::NORMAL, El::BigFloat(1),
+                   schur_off_diagonal.blocks[block], dy_columns,
+                   El::BigFloat(1), dx.blocks[block]);
             }
         }
-      Gemv(El::OrientationNS::NORMAL, El::BigFloat(1),
-           schur_off_diagonal.blocks[block], dy.blocks[block], El::BigFloat(1),
-           dx.blocks[block]);
-    }
 
-  // dx = SchurComplementCholesky^{-T} dx
-  lower_triangular_transpose_solve(schur_complement_cholesky, dx);
+      // dx = SchurComplementCholesky^{-T} dx
+      if(iterative_schur_blocks.count(block) == 0)
+        {
+          El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+                   El::OrientationNS::TRANSPOSE, El::UnitOrNonUnitNS::NON_UNIT,
+                   El::BigFloat(1), schur_complement_cholesky.blocks[block],
+                   dx.blocks[block]);
+        }
+    }
 }
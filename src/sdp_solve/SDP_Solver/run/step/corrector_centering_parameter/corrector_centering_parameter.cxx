@@ -6,17 +6,19 @@
 El::BigFloat frobenius_product_of_sums(const Block_Diagonal_Matrix &X,
                                        const Block_Diagonal_Matrix &dX,
                                        const Block_Diagonal_Matrix &Y,
-                                       const Block_Diagonal_Matrix &dY);
+                                       const Block_Diagonal_Matrix &dY,
+                                       const El::mpi::Comm &comm);
 
 // Centering parameter \beta_c for the corrector step
 El::BigFloat corrector_centering_parameter(
   const SDP_Solver_Parameters &parameters, const Block_Diagonal_Matrix &X,
   const Block_Diagonal_Matrix &dX, const Block_Diagonal_Matrix &Y,
   const Block_Diagonal_Matrix &dY, const El::BigFloat &mu,
-  const bool is_primal_dual_feasible, const size_t &total_psd_rows)
+  const bool is_primal_dual_feasible, const size_t &total_psd_rows,
+  const El::mpi::Comm &comm)
 {
   El::BigFloat r
-    = frobenius_product_of_sums(X, dX, Y, dY) / (mu * total_psd_rows);
+    = frobenius_product_of_sums(X, dX, Y, dY, comm) / (mu * total_psd_rows);
   El::BigFloat beta = r < 1 ? r * r : r;
 
   if(is_primal_dual_feasible)
@@ -1,31 +1,32 @@
 #include "../../../../Block_Diagonal_Matrix.hxx"
 
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins);
+
 // (X + dX) . (Y + dY), where X, dX, Y, dY are symmetric
 // BlockDiagonalMatrices and '.' is the Frobenius product.
 //
+// The sums are formed one element at a time, without intermediate
+// matrices.  Every element of a block is owned by exactly one
+// process, so summing the local products over all processes gives the
+// full product.  The sum is kept in extended precision throughout
+// (see Extended_Sum).
 El::BigFloat frobenius_product_of_sums(const Block_Diagonal_Matrix &X,
                                        const Block_Diagonal_Matrix &dX,
                                        const Block_Diagonal_Matrix &Y,
-                                       const Block_Diagonal_Matrix &dY)
+                                       const Block_Diagonal_Matrix &dY,
+                                       const El::mpi::Comm &comm)
 {
-  El::BigFloat local_sum(0);
+  std::vector<Extended_Sum> sums(1);
   for(size_t b = 0; b < X.blocks.size(); b++)
     {
-      // FIXME: This can be sped up by not have intermediate results.
-      // It may require looking into the implementation of Dotu.
-      El::DistMatrix<El::BigFloat> X_dX(X.blocks[b]);
-      X_dX += dX.blocks[b];
-      El::DistMatrix<El::BigFloat> Y_dY(Y.blocks[b]);
-      Y_dY += dY.blocks[b];
-      local_sum += Dotu(X_dX, Y_dY);
-    }
-
-  // Make sure not to double count if blocks are distributed over more
-  // than one processor.  We could also divide the sum by
-  // X.blocks.front().Size().
-  if(!X.blocks.empty() && X.blocks.front().Grid().Rank() != 0)
-    {
-      local_sum = 0;
+      elementwise_dotu_of_sums(
+        X.blocks[b].LockedMatrix(), dX.blocks[b].LockedMatrix(),
+        Y.blocks[b].LockedMatrix(), dY.blocks[b].LockedMatrix(), sums[0]);
     }
-  return El::mpi::AllReduce(local_sum, El::mpi::COMM_WORLD);
+  std::vector<El::BigFloat> maxes, mins;
+  fused_all_reduce(comm, sums, maxes, mins);
+  return sums[0].value();
 }
@@ -0,0 +1,25 @@
+#include "../../../SDP_Solver_Parameters.hxx"
+#include "../../../Block_Info.hxx"
+
+// The sizes of the blocks of the Schur complement matrix that are
+// formed and factored.  Blocks larger than iterative_schur_threshold
+// are solved iteratively (see Iterative_Schur_Block), so their size
+// is set to zero.
+
+std::vector<size_t>
+factored_schur_block_sizes(const SDP_Solver_Parameters &parameters,
+                           const Block_Info &block_info)
+{
+  std::vector<size_t> result(block_info.schur_block_sizes);
+  if(parameters.iterative_schur_threshold != 0)
+    {
+      for(auto &size : result)
+        {
+          if(size > parameters.iterative_schur_threshold)
+            {
+              size = 0;
+            }
+        }
+    }
+  return result;
+}
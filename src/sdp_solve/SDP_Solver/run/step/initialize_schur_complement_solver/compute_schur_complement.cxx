@@ -12,51 +12,18 @@
 //
 // where ej = d_j + 1.
 
-namespace
-{
-  // Elementwise multiplication of two submatrices.
-  //
-  // result(i,j)=(bilinear_X_inv(column_offset_X+i,row_offset_X+j)
-  //              * bilinear_Y_inv(column_offset_Y+i,row_offset_Y+j))/4
-
-  void
-  multiply_submatrices(const El::DistMatrix<El::BigFloat> &bilinear_X_inv,
-                       const El::DistMatrix<El::BigFloat> &bilinear_Y,
-                       const size_t &block_size, const size_t &column_offset_X,
-                       const size_t &row_offset_X,
-                       const size_t &column_offset_Y,
-                       const size_t &row_offset_Y,
-                       El::DistMatrix<El::BigFloat> &temp,
-                       El::DistMatrix<El::BigFloat> &result_submatrix)
-  {
-    El::DistMatrix<El::BigFloat> X_submatrix(El::LockedView(
-      bilinear_X_inv, column_offset_X, row_offset_X, block_size, block_size)),
-      Y_submatrix(El::LockedView(bilinear_Y, column_offset_Y, row_offset_Y,
-                                 block_size, block_size)),
-      Y_transpose(block_size, block_size, bilinear_Y.Grid());
+// Blocks of schur_complement that are empty are solved iteratively
+// (see Iterative_Schur_Block), so they are skipped.
 
-    // The overall result is symmetric, but this particular block may
-    // not be because it is offset from the diagonal.
-
-    // It does not help to use TransposeAxpy().  Hadamard() sets the
-    // result, it does not add it in.
-    El::Transpose(Y_submatrix, Y_transpose);
-    if(X_submatrix.ColAlign() == Y_transpose.ColAlign()
-       && X_submatrix.RowAlign() == Y_transpose.RowAlign())
-      {
-        El::Hadamard(X_submatrix, Y_transpose, temp);
-      }
-    else
-      {
-        El::DistMatrix<El::BigFloat> Y_transpose_aligned(
-          block_size, block_size, Y_transpose.Grid());
-        Y_transpose_aligned.AlignWith(X_submatrix);
-        El::Copy(Y_transpose, Y_transpose_aligned);
-        El::Hadamard(X_submatrix, Y_transpose_aligned, temp);
-      }
-    Axpy(El::BigFloat(0.25), temp, result_submatrix);
-  }
-}
+void compute_schur_sub_block(
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_X_inv,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_Y,
+  const size_t &block_size, const size_t &row_block_0,
+  const size_t &column_block_0, const size_t &row_block_1,
+  const size_t &column_block_1, El::DistMatrix<El::BigFloat> &temp,
+  El::DistMatrix<El::BigFloat> &result);
 
 void compute_schur_complement(
   const Block_Info &block_info,
@@ -75,14 +42,13 @@ void compute_schur_complement(
       const size_t block_size(block_info.degrees[block_index] + 1);
 
       for(size_t column_block_0 = 0;
-          column_block_0 < block_info.dimensions[block_index];
+          column_block_0 < block_info.dimensions[block_index]
+          && schur_complement_block->Height() != 0;
           ++column_block_0)
         {
-          const size_t column_offset_0(column_block_0 * block_size);
           for(size_t row_block_0 = 0; row_block_0 <= column_block_0;
               ++row_block_0)
             {
-              const size_t row_offset_0(row_block_0 * block_size);
               size_t result_row_offset(
                 ((column_block_0 * (column_block_0 + 1)) / 2 + row_block_0)
                 * block_size);
@@ -91,11 +57,9 @@ void compute_schur_complement(
                   column_block_1 < block_info.dimensions[block_index];
                   ++column_block_1)
                 {
-                  const size_t column_offset_1(column_block_1 * block_size);
                   for(size_t row_block_1 = 0; row_block_1 <= column_block_1;
                       ++row_block_1)
                     {
-                      const size_t row_offset_1(row_block_1 * block_size);
                       size_t result_column_offset(
                         ((column_block_1 * (column_block_1 + 1)) / 2
                          + row_block_1)
@@ -104,35 +68,15 @@ void compute_schur_complement(
                       El::DistMatrix<El::BigFloat> result_sub_matrix(El::View(
                         *schur_complement_block, result_row_offset,
                         result_column_offset, block_size, block_size));
-                      Zero(result_sub_matrix);
 
                       El::DistMatrix<El::BigFloat> temp(
                         block_size, block_size, result_sub_matrix.Grid());
 
-                      auto bilinear_X_inv(bilinear_pairings_X_inv_block);
-                      auto bilinear_Y(bilinear_pairings_Y_block);
-                      for(size_t bb(2 * block_index); bb < 2 * block_index + 2;
-                          ++bb)
-                        {
-                          multiply_submatrices(
-                            *bilinear_X_inv, *bilinear_Y, block_size,
-                            column_offset_0, row_offset_1, column_offset_1,
-                            row_offset_0, temp, result_sub_matrix);
-                          multiply_submatrices(
-                            *bilinear_X_inv, *bilinear_Y, block_size,
-                            row_offset_0, row_offset_1, column_offset_1,
-                            column_offset_0, temp, result_sub_matrix);
-                          multiply_submatrices(
-                            *bilinear_X_inv, *bilinear_Y, block_size,
-                            column_offset_0, column_offset_1, row_offset_1,
-                            row_offset_0, temp, result_sub_matrix);
-                          multiply_submatrices(
-                            *bilinear_X_inv, *bilinear_Y, block_size,
-                            row_offset_0, column_offset_1, row_offset_1,
-                            column_offset_0, temp, result_sub_matrix);
-                          ++bilinear_X_inv;
-                          ++bilinear_Y;
-                        }
+                      compute_schur_sub_block(
+                        bilinear_pairings_X_inv_block,
+                        bilinear_pairings_Y_block, block_size, row_block_0,
+                        column_block_0, row_block_1, column_block_1, temp,
+                        result_sub_matrix);
                     }
                 }
             }
@@ -0,0 +1,115 @@
+#include "../../../../elementwise.hxx"
+
+#include <El.hpp>
+
+#include <vector>
+
+// Compute the block_size x block_size sub-block of the Schur
+// complement with rows (j,r1,s1,*) and columns (j,r2,s2,*),
+//
+//   S_{(j,r1,s1,k1), (j,r2,s2,k2)} = \sum_{b \in blocks[j]}
+//          (1/4) (BilinearPairingsXInv_{ej s1 + k1, ej r2 + k2}*
+//                 BilinearPairingsY_{ej s2 + k2, ej r1 + k1} +
+//                 swaps (r1 <-> s1) and (r2 <-> s2))
+//
+// where ej = d_j + 1 = block_size.  The two parities of block j are
+// at bilinear_pairings_X_inv and bilinear_pairings_X_inv+1 (and
+// likewise for Y).  'temp' is workspace with the same shape as
+// 'result'.
+
+namespace
+{
+  bool is_aligned(const El::DistMatrix<El::BigFloat> &A,
+                  const El::DistMatrix<El::BigFloat> &B)
+  {
+    return A.ColAlign() == B.ColAlign() && A.RowAlign() == B.RowAlign();
+  }
+
+  // Elementwise multiplication of two submatrices.
+  //
+  // result(i,j)=(bilinear_X_inv(column_offset_X+i,row_offset_X+j)
+  //              * bilinear_Y_inv(column_offset_Y+i,row_offset_Y+j))/4
+
+  void
+  multiply_submatrices(const El::DistMatrix<El::BigFloat> &bilinear_X_inv,
+                       const El::DistMatrix<El::BigFloat> &bilinear_Y,
+                       const size_t &block_size, const size_t &column_offset_X,
+                       const size_t &row_offset_X,
+                       const size_t &column_offset_Y,
+                       const size_t &row_offset_Y,
+                       El::DistMatrix<El::BigFloat> &temp,
+                       El::DistMatrix<El::BigFloat> &result_submatrix)
+  {
+    El::DistMatrix<El::BigFloat> X_submatrix(El::LockedView(
+      bilinear_X_inv, column_offset_X, row_offset_X, block_size, block_size)),
+      Y_submatrix(El::LockedView(bilinear_Y, column_offset_Y, row_offset_Y,
+                                 block_size, block_size)),
+      Y_transpose(block_size, block_size, bilinear_Y.Grid());
+
+    // The overall result is symmetric, but this particular block may
+    // not be because it is offset from the diagonal.
+
+    // It does not help to use TransposeAxpy().
+    El::Transpose(Y_submatrix, Y_transpose);
+    const El::DistMatrix<El::BigFloat> *Y_aligned(&Y_transpose);
+    El::DistMatrix<El::BigFloat> Y_transpose_aligned(Y_transpose.Grid());
+    if(!is_aligned(X_submatrix, Y_transpose))
+      {
+        Y_transpose_aligned.AlignWith(X_submatrix);
+        Y_transpose_aligned.Resize(block_size, block_size);
+        El::Copy(Y_transpose, Y_transpose_aligned);
+        Y_aligned = &Y_transpose_aligned;
+      }
+
+    // Multiply and add in one pass when the result is aligned too.
+    // Otherwise, Hadamard() sets 'temp' and Axpy() redistributes it.
+    if(is_aligned(X_submatrix, result_submatrix))
+      {
+        elementwise_hadamard_axpy(
+          El::BigFloat(0.25), X_submatrix.LockedMatrix(),
+          Y_aligned->LockedMatrix(), result_submatrix.Matrix());
+      }
+    else
+      {
+        El::Hadamard(X_submatrix, *Y_aligned, temp);
+        Axpy(El::BigFloat(0.25), temp, result_submatrix);
+      }
+  }
+}
+
+void compute_schur_sub_block(
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_X_inv,
+  const std::vector<El::DistMatrix<El::BigFloat>>::const_iterator
+    &bilinear_pairings_Y,
+  const size_t &block_size, const size_t &row_block_0,
+  const size_t &column_block_0, const size_t &row_block_1,
+  const size_t &column_block_1, El::DistMatrix<El::BigFloat> &temp,
+  El::DistMatrix<El::BigFloat> &result)
+{
+  const size_t row_offset_0(row_block_0 * block_size),
+    column_offset_0(column_block_0 * block_size),
+    row_offset_1(row_block_1 * block_size),
+    column_offset_1(column_block_1 * block_size);
+
+  Zero(result);
+  auto bilinear_X_inv(bilinear_pairings_X_inv);
+  auto bilinear_Y(bilinear_pairings_Y);
+  for(size_t parity = 0; parity < 2; ++parity)
+    {
+      multiply_submatrices(*bilinear_X_inv, *bilinear_Y, block_size,
+                           column_offset_0, row_offset_1, column_offset_1,
+                           row_offset_0, temp, result);
+      multiply_submatrices(*bilinear_X_inv, *bilinear_Y, block_size,
+                           row_offset_0, row_offset_1, column_offset_1,
+                           column_offset_0, temp, result);
+      multiply_submatrices(*bilinear_X_inv, *bilinear_Y, block_size,
+                           column_offset_0, column_offset_1, row_offset_1,
+                           row_offset_0, temp, result);
+      multiply_submatrices(*bilinear_X_inv, *bilinear_Y, block_size,
+                           row_offset_0, column_offset_1, row_offset_1,
+                           column_offset_0, temp, result);
+      ++bilinear_X_inv;
+      ++bilinear_Y;
+    }
+}
@@ -0,0 +1,223 @@
+#include "../Iterative_Schur_Block.hxx"
+#include "../../../../SDP.hxx"
+#include "../../../../Block_Diagonal_Matrix.hxx"
+#include "../../../../../Timers.hxx"
+
+void synchronize_Q(El::DistMatrix<El::BigFloat> &Q,
+                   const El::DistMatrix<El::BigFloat> &Q_group,
+                   const int64_t &column_offset, const Block_Info &block_info,
+                   Timers &timers);
+
+void cholesky_lower(const size_t &replicated_factor_threshold,
+                    El::DistMatrix<El::BigFloat> &A);
+
+void lower_triangular_solve(const size_t &replicated_factor_threshold,
+                            const El::DistMatrix<El::BigFloat> &L,
+                            El::DistMatrix<El::BigFloat> &B);
+
+namespace
+{
+  // The number of columns of Q to compute and synchronize at a time.
+  // Each process holds its share of a panel of Q_group, as well as
+  // the send and receive buffers in synchronize_Q.  max_Q_memory is
+  // in MiB, and 0 means no limit.  Every process has to use the same
+  // width, so we take the smallest.
+  int64_t Q_panel_width(const size_t &max_Q_memory,
+                        const Block_Info &block_info, const int64_t &Q_height)
+  {
+    if(max_Q_memory == 0)
+      {
+        return Q_height;
+      }
+    const size_t num_procs(El::mpi::Size(block_info.solver_comm)),
+      group_size(El::mpi::Size(block_info.mpi_comm.value)),
+      procs_per_node(std::min(block_info.procs_per_node, num_procs));
+    const double elements_per_column(
+      Q_height * (1.0 / group_size + 4.0 / procs_per_node)),
+      bytes_per_element(El::BigFloat(0).SerializedSize());
+
+    int64_t width(max_Q_memory * 1024.0 * 1024.0
+                  / (elements_per_column * bytes_per_element));
+    width = El::mpi::AllReduce(width, El::mpi::MIN, block_info.solver_comm);
+    return std::max(int64_t(1), std::min(width, Q_height));
+  }
+
+  // Explicitly deallocate the part of Q_group below the diagonal of
+  // Q.  This significantly reduces the total amount of memory
+  // required.
+  void free_lower_triangle(const int64_t &column_offset,
+                           El::DistMatrix<El::BigFloat> &Q_group)
+  {
+    El::Matrix<El::BigFloat> &local(Q_group.Matrix());
+    for(int64_t row = 0; row < Q_group.Height(); ++row)
+      for(int64_t column = 0; column + column_offset < row; ++column)
+        {
+          if(Q_group.IsLocal(row, column))
+            {
+              mpf_clear(local(Q_group.LocalRow(row), Q_group.LocalCol(column))
+                          .gmp_float.get_mpf_t());
+              local(Q_group.LocalRow(row), Q_group.LocalCol(column))
+                .gmp_float.get_mpf_t()[0]
+                ._mp_d
+                = nullptr;
+            }
+        }
+  }
+}
+
+void initialize_Q(
+  const SDP &sdp, const Block_Info &block_info,
+  const Block_Diagonal_Matrix &schur_complement,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const size_t &max_Q_memory, const size_t &replicated_factor_threshold,
+  const El::Grid &group_grid, Block_Matrix &schur_off_diagonal,
+  Block_Diagonal_Matrix &schur_complement_cholesky,
+  El::DistMatrix<El::BigFloat> &Q, Timers &timers)
+{
+  schur_off_diagonal.blocks.clear();
+  schur_off_diagonal.blocks.reserve(schur_complement_cholesky.blocks.size());
+
+  for(size_t block = 0; block < schur_complement_cholesky.blocks.size();
+      ++block)
+    {
+      auto iterative_block(iterative_schur_blocks.find(block));
+      if(iterative_block != iterative_schur_blocks.end())
+        {
+          // schur_off_diagonal = S^{-1} B
+          auto &iterative_solve_timer(timers.add_and_start(
+            "run.step.initializeSchurComplementSolver.Q.iterative_solve_"
+            + std::to_string(block_info.block_indices[block])));
+          schur_off_diagonal.blocks.push_back(
+            sdp.free_var_matrix.blocks[block]);
+          iterative_block->second.solve(schur_off_diagonal.blocks[block]);
+          iterative_solve_timer.stop();
+          continue;
+        }
+
+      auto &cholesky_timer(timers.add_and_start(
+        "run.step.initializeSchurComplementSolver.Q.cholesky_"
+        + std::to_string(block_info.block_indices[block])));
+      schur_complement_cholesky.blocks[block] = schur_complement.blocks[block];
+
+      cholesky_lower(replicated_factor_threshold,
+                     schur_complement_cholesky.blocks[block]);
+      cholesky_timer.stop();
+
+      // schur_off_diagonal = L^{-1} B
+      auto &solve_timer(timers.add_and_start(
+        "run.step.initializeSchurComplementSolver.Q.solve_"
+        + std::to_string(block_info.block_indices[block])));
+
+      schur_off_diagonal.blocks.push_back(sdp.free_var_matrix.blocks[block]);
+      lower_triangular_solve(replicated_factor_threshold,
+                             schur_complement_cholesky.blocks[block],
+                             schur_off_diagonal.blocks[block]);
+
+      solve_timer.stop();
+    }
+
+  // The time for each block is summed over all of the panels.  The
+  // timers are created even if Q is never formed, because the timing
+  // run expects one for every block.
+  std::vector<Timer *> syrk_timers;
+  for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+    {
+      syrk_timers.push_back(&timers.add_and_start(
+        "run.step.initializeSchurComplementSolver.Q.syrk_"
+        + std::to_string(block_info.block_indices[block])));
+      syrk_timers.back()->stop();
+    }
+
+  // An empty Q is solved iteratively without ever being formed.
+  if(Q.Height() == 0)
+    {
+      return;
+    }
+
+  // Q = (L^{-1} B)^T (L^{-1} B) = schur_off_diagonal^T schur_off_diagonal
+  //
+  // For iterative blocks, Q = B^T (S^{-1} B) = B^T schur_off_diagonal.
+  //
+  // Build the upper triangle of Q one panel of columns at a time, so
+  // that only a panel of Q_group is ever allocated.  Without a memory
+  // limit, there is a single panel covering all of Q.
+  const int64_t Q_height(Q.Height()),
+    panel_width(Q_panel_width(max_Q_memory, block_info, Q_height));
+
+  for(int64_t column_offset = 0; column_offset < Q_height;
+      column_offset += panel_width)
+    {
+      const int64_t column_end(std::min(Q_height, column_offset + panel_width)),
+        width(column_end - column_offset);
+
+      // Only rows above the bottom of the panel are in the upper
+      // triangle.
+      El::DistMatrix<El::BigFloat> Q_group(column_end, width, group_grid);
+      free_lower_triangle(column_offset, Q_group);
+
+      for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+        {
+          syrk_timers[block]->resume();
+          const El::DistMatrix<El::BigFloat> &block_off_diagonal(
+            schur_off_diagonal.blocks[block]);
+          const bool is_iterative(iterative_schur_blocks.count(block) != 0);
+          const El::DistMatrix<El::BigFloat> &block_left(
+            is_iterative ? sdp.free_var_matrix.blocks[block]
+                         : block_off_diagonal);
+
+          // Only the stored columns of B, [block_begin, block_end),
+          // contribute to Q.  Within this panel, they only touch
+          // columns [panel_begin, panel_end) of Q, rows
+          // [block_begin, above_end) above the panel, and the
+          // [panel_begin, panel_end) square on the diagonal.
+          const int64_t block_begin(sdp.free_var_column_offsets[block]),
+            block_end(block_begin + block_off_diagonal.Width()),
+            panel_begin(std::max(column_offset, block_begin)),
+            panel_end(std::min(column_end, block_end)),
+            above_end(std::min(column_offset, block_end));
+          if(panel_begin < panel_end)
+            {
+              El::DistMatrix<El::BigFloat> panel_off_diagonal(El::LockedView(
+                block_off_diagonal, 0, panel_begin - block_begin,
+                block_off_diagonal.Height(), panel_end - panel_begin));
+              if(block_begin < above_end)
+                {
+                  El::DistMatrix<El::BigFloat> Q_group_above(El::View(
+                    Q_group, block_begin, panel_begin - column_offset,
+                    above_end - block_begin, panel_end - panel_begin));
+                  El::Gemm(El::OrientationNS::TRANSPOSE,
+                           El::OrientationNS::NORMAL, El::BigFloat(1),
+                           El::LockedView(block_left, 0, 0,
+                                          block_left.Height(),
+                                          above_end - block_begin),
+                           panel_off_diagonal, El::BigFloat(1),
+                           Q_group_above);
+                }
+              El::DistMatrix<El::BigFloat> Q_group_diagonal(El::View(
+                Q_group, panel_begin, panel_begin - column_offset,
+                panel_end - panel_begin, panel_end - panel_begin));
+              if(is_iterative)
+                {
+                  El::Trrk(El::UpperOrLowerNS::UPPER,
+                           El::OrientationNS::TRANSPOSE,
+                           El::OrientationNS::NORMAL, El::BigFloat(1),
+                           El::LockedView(block_left, 0,
+                                          panel_begin - block_begin,
+                                          block_left.Height(),
+                                          panel_end - panel_begin),
+                           panel_off_diagonal, El::BigFloat(1),
+                           Q_group_diagonal);
+                }
+              else
+                {
+                  El::Syrk(El::UpperOrLowerNS::UPPER,
+                           El::OrientationNS::TRANSPOSE, El::BigFloat(1),
+                           panel_off_diagonal, El::BigFloat(1),
+                           Q_group_diagonal);
+                }
+            }
+          syrk_timers[block]->stop();
+        }
+      synchronize_Q(Q, Q_group, column_offset, block_info, timers);
+    }
+}
@@ -1,4 +1,6 @@
+#include "../Iterative_Schur_Block.hxx"
 #include "../../../../SDP.hxx"
+#include "../../../../SDP_Solver_Parameters.hxx"
 #include "../../../../Block_Diagonal_Matrix.hxx"
 #include "../../../../../Timers.hxx"
 
@@ -22,6 +24,14 @@
 //
 // - Compute the LU decomposition of Q.
 //
+// If Q is empty (more free variables than iterativeQThreshold), Q is
+// not formed or factored.  It is solved iteratively in
+// solve_schur_complement_equation instead.
+//
+// Blocks of S larger than iterativeSchurThreshold are never formed.
+// For those blocks, SchurOffDiagonal = S^{-1} B instead, computed
+// with conjugate gradients (see Iterative_Schur_Block).
+//
 // This data is sufficient to efficiently solve the above equation for
 // a given r,s.
 //
@@ -36,6 +46,7 @@
 // used later):
 // - SchurComplementCholesky
 // - SchurOffDiagonal
+// - IterativeSchurBlocks
 //
 
 void compute_schur_complement(
@@ -44,54 +55,95 @@ void compute_schur_complement(
   const Block_Diagonal_Matrix &bilinear_pairings_Y,
   Block_Diagonal_Matrix &schur_complement, Timers &timers);
 
-void initialize_Q_group(const SDP &sdp, const Block_Info &block_info,
-                        const Block_Diagonal_Matrix &schur_complement,
-                        Block_Matrix &schur_off_diagonal,
-                        Block_Diagonal_Matrix &schur_complement_cholesky,
-                        El::DistMatrix<El::BigFloat> &Q_group, Timers &timers);
+std::vector<size_t>
+factored_schur_block_sizes(const SDP_Solver_Parameters &parameters,
+                           const Block_Info &block_info);
 
-void synchronize_Q(El::DistMatrix<El::BigFloat> &Q,
-                   const El::DistMatrix<El::BigFloat> &Q_group,
-                   Timers &timers);
+void initialize_Q(
+  const SDP &sdp, const Block_Info &block_info,
+  const Block_Diagonal_Matrix &schur_complement,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  const size_t &max_Q_memory, const size_t &replicated_factor_threshold,
+  const El::Grid &group_grid, Block_Matrix &schur_off_diagonal,
+  Block_Diagonal_Matrix &schur_complement_cholesky,
+  El::DistMatrix<El::BigFloat> &Q, Timers &timers);
 
 void initialize_schur_complement_solver(
-  const Block_Info &block_info, const SDP &sdp,
+  const SDP_Solver_Parameters &parameters, const Block_Info &block_info,
+  const SDP &sdp,
   const Block_Diagonal_Matrix &bilinear_pairings_X_inv,
   const Block_Diagonal_Matrix &bilinear_pairings_Y, const El::Grid &group_grid,
   Block_Diagonal_Matrix &schur_complement_cholesky,
-  Block_Matrix &schur_off_diagonal, El::DistMatrix<El::BigFloat> &Q,
-  Timers &timers)
+  Block_Matrix &schur_off_diagonal,
+  std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  El::DistMatrix<El::BigFloat> &Q, Timers &timers)
 {
   auto &initialize_timer(
     timers.add_and_start("run.step.initializeSchurComplementSolver"));
   // The Schur complement matrix S: a Block_Diagonal_Matrix with one
   // block for each 0 <= j < J.  SchurComplement.blocks[j] has dimension
-  // (d_j+1)*m_j*(m_j+1)/2
+  // (d_j+1)*m_j*(m_j+1)/2, or is empty if it is solved iteratively.
   //
   Block_Diagonal_Matrix schur_complement(
-    block_info.schur_block_sizes, block_info.block_indices,
-    block_info.schur_block_sizes.size(), group_grid);
+    factored_schur_block_sizes(parameters, block_info),
+    block_info.block_indices, block_info.schur_block_sizes.size(),
+    group_grid);
 
   compute_schur_complement(block_info, bilinear_pairings_X_inv,
                            bilinear_pairings_Y, schur_complement, timers);
 
+  iterative_schur_blocks.clear();
+  for(size_t block = 0; block < block_info.block_indices.size(); ++block)
+    {
+      if(schur_complement.blocks[block].Height() == 0)
+        {
+          const size_t block_index(block_info.block_indices[block]);
+          auto &preconditioner_timer(timers.add_and_start(
+            "run.step.initializeSchurComplementSolver.preconditioner_"
+            + std::to_string(block_index)));
+          iterative_schur_blocks.emplace(
+            block, Iterative_Schur_Block(
+                     block_info.degrees[block_index] + 1,
+                     block_info.dimensions[block_index],
+                     bilinear_pairings_X_inv.blocks.begin() + 2 * block,
+                     bilinear_pairings_Y.blocks.begin() + 2 * block,
+                     parameters.iterative_schur_tolerance,
+                     parameters.cache_iterative_schur_blocks));
+          preconditioner_timer.stop();
+        }
+    }
+
   auto &Q_computation_timer(
     timers.add_and_start("run.step.initializeSchurComplementSolver.Q"));
 
-  {
-    // FIXME: Change initialize_Q_group to initialize_Q and
-    // synchronize inside.
-    El::DistMatrix<El::BigFloat> Q_group(Q.Height(), Q.Width(), group_grid);
-    initialize_Q_group(sdp, block_info, schur_complement, schur_off_diagonal,
-                       schur_complement_cholesky, Q_group, timers);
-    synchronize_Q(Q, Q_group, timers);
-  }
+  initialize_Q(sdp, block_info, schur_complement, iterative_schur_blocks,
+               parameters.max_Q_memory, parameters.replicated_factor_threshold,
+               group_grid, schur_off_diagonal, schur_complement_cholesky, Q,
+               timers);
   Q_computation_timer.stop();
 
-  auto &Cholesky_timer(
-    timers.add_and_start("run.step.initializeSchurComplementSolver."
-                         "Cholesky"));
-  Cholesky(El::UpperOrLowerNS::UPPER, Q);
-  Cholesky_timer.stop();
+  // Only Q and L are needed to solve the Schur complement equation.
+  // So, if requested, free SchurOffDiagonal and recompute products
+  // with it from B.  Iteratively solved blocks and an iterative Q
+  // still need it.
+  if(parameters.recompute_schur_off_diagonal && Q.Height() != 0)
+    {
+      for(size_t block = 0; block < schur_off_diagonal.blocks.size(); ++block)
+        {
+          if(iterative_schur_blocks.count(block) == 0)
+            {
+              schur_off_diagonal.blocks[block].Empty();
+            }
+        }
+    }
+
+  if(Q.Height() != 0)
+    {
+      auto &Cholesky_timer(
+        timers.add_and_start("run.step.initializeSchurComplementSolver."
+                             "Cholesky"));
+      Cholesky(El::UpperOrLowerNS::UPPER, Q);
+      Cholesky_timer.stop();
+    }
   initialize_timer.stop();
 }
@@ -1,10 +1,13 @@
 // Synchronize the results back to the global Q.
 
+#include "../../../../Block_Info.hxx"
 #include "../../../../../Timers.hxx"
 
 #include <El.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 
 namespace
 {
@@ -18,170 +21,538 @@ namespace
         El::RuntimeError(std::string(error_string.data()));
       }
   }
-}
 
-void synchronize_Q(El::DistMatrix<El::BigFloat> &Q,
-                   const El::DistMatrix<El::BigFloat> &Q_group, Timers &timers)
-{
-  auto &synchronize_Q_buffers_timer(timers.add_and_start(
-    "run.step.initializeSchurComplementSolver.Q.synchronize_Q"));
+  // Which rank owns which element of Q only depends on the size and
+  // distribution of Q.  That does not change between iterations, so
+  // we only compute it once.  Q is distributed element-wise
+  // cyclically, so the elements owned by a rank are the product of a
+  // set of rows and a set of columns.  This lets us enumerate the
+  // elements owned by any rank without scanning all of Q.
+  struct Synchronize_Q_Plan
+  {
+    int64_t height = -1;
+    int grid_size = 0, col_stride = 0, row_stride = 0, col_align = 0,
+        row_align = 0;
 
-  const int total_ranks(El::mpi::Size(El::mpi::COMM_WORLD));
-  // Special case serial case
-  if(total_ranks == 1)
+    // rows[col_owner] and columns[row_owner] are the global rows and
+    // columns of Q that belong to each process row and process
+    // column.
+    std::vector<std::vector<int64_t>> rows, columns;
+    // The process row and column of each rank, or -1 if that rank
+    // does not own any elements.
+    std::vector<int> rank_col_owner, rank_row_owner;
+
+    bool is_compatible(const El::DistMatrix<El::BigFloat> &Q) const
     {
-      for(int64_t row = 0; row < Q_group.Height(); ++row)
-        for(int64_t column = row; column < Q_group.Height(); ++column)
+      return height == Q.Height() && grid_size == Q.Grid().Size()
+             && col_stride == Q.ColStride() && row_stride == Q.RowStride()
+             && col_align == Q.ColAlign() && row_align == Q.RowAlign();
+    }
+
+    void reset(const El::DistMatrix<El::BigFloat> &Q)
+    {
+      height = Q.Height();
+      grid_size = Q.Grid().Size();
+      col_stride = Q.ColStride();
+      row_stride = Q.RowStride();
+      col_align = Q.ColAlign();
+      row_align = Q.RowAlign();
+
+      rows.clear();
+      rows.resize(col_stride);
+      columns.clear();
+      columns.resize(row_stride);
+      for(int64_t index = 0; index < height; ++index)
+        {
+          rows.at(Q.ColOwner(index)).push_back(index);
+          columns.at(Q.RowOwner(index)).push_back(index);
+        }
+
+      rank_col_owner.assign(grid_size, -1);
+      rank_row_owner.assign(grid_size, -1);
+      for(int col_owner = 0; col_owner < col_stride; ++col_owner)
+        for(int row_owner = 0; row_owner < row_stride; ++row_owner)
           {
-            Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column),
-                       Q_group.GetLocal(Q_group.LocalRow(row),
-                                        Q_group.LocalCol(column)));
+            if(rows[col_owner].empty() || columns[row_owner].empty())
+              {
+                continue;
+              }
+            const int owner(
+              Q.Owner(rows[col_owner].front(), columns[row_owner].front()));
+            rank_col_owner.at(owner) = col_owner;
+            rank_row_owner.at(owner) = row_owner;
           }
-      return;
     }
 
-  El::BigFloat zero(0);
-  size_t serialized_size(zero.SerializedSize());
-  std::vector<uint8_t> serialized_zero(serialized_size);
-  zero.Serialize(serialized_zero.data());
+    // Call f(row,column) for every element in the upper triangle of Q
+    // owned by 'rank' with column_begin <= column < column_end.
+    // Every rank walks through the elements in the same order, so
+    // this order defines the layout of the messages.
+    template <typename F>
+    void for_each_element(const int &rank, const int64_t &column_begin,
+                          const int64_t &column_end, F f) const
+    {
+      if(rank_col_owner[rank] == -1)
+        {
+          return;
+        }
+      auto &owned_rows(rows[rank_col_owner[rank]]);
+      auto &owned_columns(columns[rank_row_owner[rank]]);
+      for(auto column(std::lower_bound(owned_columns.begin(),
+                                       owned_columns.end(), column_begin));
+          column != owned_columns.end() && *column < column_end; ++column)
+        {
+          for(auto row(owned_rows.begin());
+              row != owned_rows.end() && *row <= *column; ++row)
+            {
+              f(*row, *column);
+            }
+        }
+    }
 
-  // This is an re-implementation of MPI_Reduce_scatter
-  // using the ring algorithm as found in OpenMPI.
+    // Number of elements that for_each_element visits for each rank.
+    // MPI uses 'int' for message sizes.
+    std::vector<int>
+    rank_sizes(const int64_t &column_begin, const int64_t &column_end) const
+    {
+      std::vector<int> result(rank_col_owner.size(), 0);
+      for(size_t rank = 0; rank < result.size(); ++rank)
+        {
+          if(rank_col_owner[rank] == -1)
+            {
+              continue;
+            }
+          auto &owned_rows(rows[rank_col_owner[rank]]);
+          auto &owned_columns(columns[rank_row_owner[rank]]);
+          int64_t size(0);
+          for(auto column(std::lower_bound(
+                owned_columns.begin(), owned_columns.end(), column_begin));
+              column != owned_columns.end() && *column < column_end; ++column)
+            {
+              size += std::distance(owned_rows.begin(),
+                                    std::upper_bound(owned_rows.begin(),
+                                                     owned_rows.end(),
+                                                     *column));
+            }
+          result[rank] = size;
+        }
+      return result;
+    }
+  };
+
+  // Append the local contributions of Q_group to the elements owned
+  // by 'destination'.  Q_group holds the columns of Q starting at
+  // column_offset.  Elements that are not local, or are zero, are
+  // nullptr, so they never have to be sent.
+  void local_contributions(const Synchronize_Q_Plan &plan,
+                           const El::DistMatrix<El::BigFloat> &Q_group,
+                           const int64_t &column_offset,
+                           const int &destination,
+                           std::vector<const El::BigFloat *> &contributions)
+  {
+    const El::BigFloat zero(0);
+    const El::Matrix<El::BigFloat> &local(Q_group.LockedMatrix());
+    plan.for_each_element(
+      destination, column_offset, column_offset + Q_group.Width(),
+      [&](const int64_t &row, const int64_t &column) {
+        const El::BigFloat *element(nullptr);
+        if(Q_group.IsLocal(row, column - column_offset))
+          {
+            element = &local(Q_group.LocalRow(row),
+                             Q_group.LocalCol(column - column_offset));
+            if(*element == zero)
+              {
+                element = nullptr;
+              }
+          }
+        contributions.push_back(element);
+      });
+  }
 
+  // Contributions either point directly at an element of Q_group, or
+  // at a serialized partial sum from an earlier reduction.
+  void add_to(const El::BigFloat *contribution, El::BigFloat &accumulator,
+              El::BigFloat &)
+  {
+    accumulator += *contribution;
+  }
+  void add_to(const El::byte *contribution, El::BigFloat &accumulator,
+              El::BigFloat &scratch)
+  {
+    scratch.Deserialize(contribution);
+    accumulator += scratch;
+  }
+  void serialize_to(const El::BigFloat *contribution, const size_t &,
+                    El::byte *destination)
+  {
+    contribution->Serialize(destination);
+  }
+  void serialize_to(const El::byte *contribution,
+                    const size_t &serialized_size, El::byte *destination)
+  {
+    std::memcpy(destination, contribution, serialized_size);
+  }
+
+  // Messages are packed.  'mask' has one entry for each element owned
+  // by the destination, and is non-zero if that element has a value
+  // in 'values'.  This adds the local contributions into the message
+  // in place and returns the new number of values.  We work
+  // backwards so that inserting values never overwrites values that
+  // we have not read yet.  'accumulator' and 'scratch' are reused to
+  // avoid allocating a new El::BigFloat for every element.
+  template <typename T>
+  int add_contributions(const std::vector<T> &contributions,
+                        const size_t &serialized_size, const int &num_received,
+                        El::BigFloat &accumulator, El::BigFloat &scratch,
+                        std::vector<El::byte> &mask,
+                        std::vector<El::byte> &values)
+  {
+    int num_packed(num_received);
+    for(size_t index = 0; index < contributions.size(); ++index)
+      {
+        if(contributions[index] != nullptr && mask[index] == 0)
+          {
+            ++num_packed;
+          }
+      }
+
+    int64_t in_position(num_received), out_position(num_packed);
+    for(size_t index(contributions.size()); index-- > 0;)
+      {
+        if(mask[index] != 0)
+          {
+            --in_position;
+            --out_position;
+            El::byte *in(values.data() + in_position * serialized_size),
+              *out(values.data() + out_position * serialized_size);
+            if(contributions[index] != nullptr)
+              {
+                accumulator.Deserialize(in);
+                add_to(contributions[index], accumulator, scratch);
+                accumulator.Serialize(out);
+              }
+            else if(in != out)
+              {
+                std::memmove(out, in, serialized_size);
+              }
+          }
+        else if(contributions[index] != nullptr)
+          {
+            --out_position;
+            serialize_to(contributions[index], serialized_size,
+                         values.data() + out_position * serialized_size);
+            mask[index] = 1;
+          }
+      }
+    return num_packed;
+  }
+
+  int count_received(const std::vector<El::byte> &mask, const int &size)
+  {
+    return std::count_if(mask.begin(), mask.begin() + size,
+                         [](const El::byte &m) { return m != 0; });
+  }
+
+  // This is an re-implementation of MPI_Reduce_scatter over 'comm'
+  // using the ring algorithm as found in OpenMPI.
+  //
   // We re-implement MPI_Reduce_scatter because we can get away with
   // significantly less memory use by not constructing the full send
   // buffer beforehand.  Also, for large blocks, we can skip some
   // elements when summing because those processors do not have
-  // contributions for all of Q.
+  // contributions for all of Q.  Those elements are left out of the
+  // messages entirely, rather than sent as serialized zeros.
+  //
+  // sizes[destination] is the number of elements summed onto each
+  // rank of 'comm', and set_contributions(destination, contributions)
+  // appends this rank's contributions to those elements.  The result
+  // for this rank is returned in 'result_mask' and 'result_values'.
+  template <typename T, typename F>
+  void ring_reduce_scatter(const El::mpi::Comm &comm,
+                           const std::vector<int> &sizes,
+                           const size_t &serialized_size,
+                           const F &set_contributions,
+                           El::BigFloat &accumulator, El::BigFloat &scratch,
+                           std::vector<El::byte> &result_mask,
+                           std::vector<El::byte> &result_values)
+  {
+    const int total_ranks(El::mpi::Size(comm)), rank(El::mpi::Rank(comm));
+    const int max_size(*std::max_element(sizes.begin(), sizes.end()));
+    std::array<std::vector<El::byte>, 2> masks(
+      {std::vector<El::byte>(max_size), std::vector<El::byte>(max_size)}),
+      values({std::vector<El::byte>(max_size * serialized_size),
+              std::vector<El::byte>(max_size * serialized_size)});
+    std::vector<T> contributions;
+    contributions.reserve(max_size);
 
-  // MPI uses 'int' for message sizes.
-  std::vector<int> rank_sizes(total_ranks);
-  for(int64_t row = 0; row < Q_group.Height(); ++row)
-    for(int64_t column = row; column < Q_group.Height(); ++column)
+    auto reduce_into = [&](const int &slot, const int &destination,
+                           const int &num_received) {
+      contributions.clear();
+      set_contributions(destination, contributions);
+      return add_contributions(contributions, serialized_size, num_received,
+                               accumulator, scratch, masks[slot],
+                               values[slot]);
+    };
+
+    if(total_ranks == 1)
       {
-        ++rank_sizes.at(Q.Owner(row, column));
+        reduce_into(0, rank, 0);
+        std::swap(result_mask, masks[0]);
+        std::swap(result_values, values[0]);
+        return;
       }
 
-  int max_buffer_size(*std::max_element(rank_sizes.begin(), rank_sizes.end())
-                      * serialized_size);
-  std::array<std::vector<El::byte>, 2> send_receive(
-    {std::vector<El::byte>(max_buffer_size),
-     std::vector<El::byte>(max_buffer_size)});
+    const int send_to_rank((rank + 1) % total_ranks),
+      receive_from_rank((total_ranks + rank - 1) % total_ranks);
 
-  const int rank(El::mpi::Rank(El::mpi::COMM_WORLD));
-  const int send_to_rank((rank + 1) % total_ranks),
-    receive_from_rank((total_ranks + rank - 1) % total_ranks);
+    // Each message is sent as a mask followed by the packed values.
+    // Messages between two ranks with the same tag arrive in the
+    // order that they were sent, so the receives are matched in
+    // order.
+    std::array<std::array<MPI_Request, 2>, 2> receive_requests;
+    auto post_receive = [&](const int &slot, const int &destination) {
+      check_mpi_error(MPI_Irecv(masks[slot].data(), sizes[destination],
+                                MPI_BYTE, receive_from_rank, destination,
+                                comm.comm, &receive_requests[slot][0]));
+      check_mpi_error(MPI_Irecv(values[slot].data(), sizes[destination],
+                                El::mpi::TypeMap<El::BigFloat>(),
+                                receive_from_rank, destination, comm.comm,
+                                &receive_requests[slot][1]));
+    };
+    auto wait_receive = [&](const int &slot) {
+      // We do not cancel sends, so no need to check status.
+      check_mpi_error(MPI_Waitall(2, receive_requests[slot].data(),
+                                  MPI_STATUSES_IGNORE));
+    };
+    auto send = [&](const int &slot, const int &destination,
+                    const int &num_packed) {
+      check_mpi_error(MPI_Send(masks[slot].data(), sizes[destination],
+                               MPI_BYTE, send_to_rank, destination,
+                               comm.comm));
+      check_mpi_error(MPI_Send(values[slot].data(), num_packed,
+                               El::mpi::TypeMap<El::BigFloat>(),
+                               send_to_rank, destination, comm.comm));
+    };
 
-  // Initial async receive
-  int final_receive_destination((total_ranks + rank - 2) % total_ranks);
-  std::array<MPI_Request, 2> receive_requests;
-  check_mpi_error(MPI_Irecv(send_receive[0].data(),
-                            rank_sizes[final_receive_destination],
-                            El::mpi::TypeMap<El::BigFloat>(),
-                            receive_from_rank, final_receive_destination,
-                            El::mpi::COMM_WORLD.comm, &receive_requests[0]));
+    // Initial async receive
+    int final_receive_destination((total_ranks + rank - 2) % total_ranks);
+    post_receive(0, final_receive_destination);
 
-  // Initial fill of send buffer
-  int final_send_destination((total_ranks + rank - 1) % total_ranks);
+    // Initial fill of send buffer
+    {
+      const int final_send_destination((total_ranks + rank - 1)
+                                       % total_ranks);
+      send(1, final_send_destination,
+           reduce_into(1, final_send_destination, 0));
+    }
 
-  {
-    El::byte *insertion_point(send_receive[1].data());
-    for(int64_t row = 0; row < Q_group.Height(); ++row)
-      for(int64_t column = row; column < Q_group.Height(); ++column)
-        {
-          if(Q.Owner(row, column) == final_send_destination)
-            {
-              if(Q_group.IsLocal(row, column))
-                {
-                  Q_group
-                    .GetLocal(Q_group.LocalRow(row), Q_group.LocalCol(column))
-                    .Serialize(insertion_point);
-                }
-              else
-                {
-                  std::copy(serialized_zero.begin(), serialized_zero.end(),
-                            insertion_point);
-                }
-              insertion_point += serialized_size;
-            }
-        }
+    // Loop over all remaining intermediate ranks
+    for(int rank_offset(2); rank_offset < total_ranks; ++rank_offset)
+      {
+        final_receive_destination
+          = (total_ranks + rank - (rank_offset + 1)) % total_ranks;
+        post_receive((rank_offset + 1) % 2, final_receive_destination);
+
+        // This waits for the receive from a previous iteration, not
+        // the one we just initiated.
+        const int slot(rank_offset % 2);
+        wait_receive(slot);
+
+        const int final_send_destination((total_ranks + rank - rank_offset)
+                                         % total_ranks);
+        send(slot, final_send_destination,
+             reduce_into(slot, final_send_destination,
+                         count_received(masks[slot],
+                                        sizes[final_send_destination])));
+      }
+
+    // Add the local contribution to the last message.
+    const int slot(total_ranks % 2);
+    wait_receive(slot);
+    reduce_into(slot, rank, count_received(masks[slot], sizes[rank]));
+    std::swap(result_mask, masks[slot]);
+    std::swap(result_values, values[slot]);
   }
+}
 
-  check_mpi_error(MPI_Send(send_receive[1].data(),
-                           rank_sizes[final_send_destination],
-                           El::mpi::TypeMap<El::BigFloat>(), send_to_rank,
-                           final_send_destination, El::mpi::COMM_WORLD.comm));
+// Q_group holds the upper triangle of the columns of Q starting at
+// column_offset.  Add up Q_group from every group and put the result
+// in those columns of Q.
+void synchronize_Q(El::DistMatrix<El::BigFloat> &Q,
+                   const El::DistMatrix<El::BigFloat> &Q_group,
+                   const int64_t &column_offset, const Block_Info &block_info,
+                   Timers &timers)
+{
+  auto &synchronize_Q_buffers_timer(timers.add_and_start(
+    "run.step.initializeSchurComplementSolver.Q.synchronize_Q"));
 
-  // Loop over all remaining intermediate ranks
-  for(int rank_offset(2); rank_offset < total_ranks; ++rank_offset)
+  const int64_t column_end(column_offset + Q_group.Width());
+  const int total_ranks(El::mpi::Size(block_info.solver_comm));
+  // Special case serial case
+  if(total_ranks == 1)
     {
-      {
-        auto &receive_buffer(send_receive[(rank_offset + 1) % 2]);
+      for(int64_t column = column_offset; column < column_end; ++column)
+        for(int64_t row = 0; row <= column; ++row)
+          {
+            Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column),
+                       Q_group.GetLocal(Q_group.LocalRow(row),
+                                        Q_group.LocalCol(column
+                                                         - column_offset)));
+          }
+      synchronize_Q_buffers_timer.stop();
+      return;
+    }
 
-        final_receive_destination
-          = (total_ranks + rank - (rank_offset + 1)) % total_ranks;
+  static Synchronize_Q_Plan plan;
+  if(!plan.is_compatible(Q))
+    {
+      plan.reset(Q);
+    }
+  const std::vector<int> rank_sizes(plan.rank_sizes(column_offset, column_end));
 
-        check_mpi_error(MPI_Irecv(
-          receive_buffer.data(), rank_sizes[final_receive_destination],
-          El::mpi::TypeMap<El::BigFloat>(), receive_from_rank,
-          final_receive_destination, El::mpi::COMM_WORLD.comm,
-          &receive_requests[(rank_offset + 1) % 2]));
-      }
-      {
-        // This waits for the receive from a previous iteration, not the
-        // one we just initiated.
-
-        // We do not cancel sends, so no need to check status.
-        check_mpi_error(
-          MPI_Wait(&receive_requests[rank_offset % 2], MPI_STATUS_IGNORE));
-
-        final_send_destination
-          = (total_ranks + rank - rank_offset) % total_ranks;
-        auto &receive_then_send_buffer(send_receive[rank_offset % 2]);
-        El::byte *current_receiving(receive_then_send_buffer.data());
-        for(int64_t row = 0; row < Q_group.Height(); ++row)
-          for(int64_t column = row; column < Q_group.Height(); ++column)
+  El::BigFloat accumulator(0), scratch(0);
+  const size_t serialized_size(accumulator.SerializedSize());
+  const int rank(El::mpi::Rank(block_info.solver_comm));
+  std::vector<El::byte> mask, values;
+
+  if(Q.Grid().Size() != total_ranks)
+    {
+      // Q is replicated on every node, and distributed among the
+      // processes of that node.  Processes with the same node-local
+      // rank own the same elements of Q on every node.  So first
+      // reduce within the node onto the owners of Q, and then add up
+      // the results from every node.
+      ring_reduce_scatter<const El::BigFloat *>(
+        block_info.node_comm.value, rank_sizes, serialized_size,
+        [&](const int &destination,
+            std::vector<const El::BigFloat *> &contributions) {
+          local_contributions(plan, Q_group, column_offset, destination,
+                              contributions);
+        },
+        accumulator, scratch, mask, values);
+
+      std::vector<El::BigFloat> sums(rank_sizes[Q.DistRank()]);
+      const El::byte *current_receiving(values.data());
+      for(size_t index = 0; index < sums.size(); ++index)
+        {
+          if(mask[index] != 0)
             {
-              if(Q.Owner(row, column) == final_send_destination)
-                {
-                  if(Q_group.IsLocal(row, column))
-                    {
-                      El::BigFloat received;
-                      received.Deserialize(current_receiving);
-                      received += Q_group.GetLocal(Q_group.LocalRow(row),
-                                                   Q_group.LocalCol(column));
-                      received.Serialize(current_receiving);
-                    }
-                  current_receiving += serialized_size;
-                }
+              sums[index].Deserialize(current_receiving);
+              current_receiving += serialized_size;
             }
-        check_mpi_error(MPI_Send(
-          receive_then_send_buffer.data(), rank_sizes[final_send_destination],
-          El::mpi::TypeMap<El::BigFloat>(), send_to_rank,
-          final_send_destination, El::mpi::COMM_WORLD.comm));
-      }
+          else
+            {
+              sums[index] = 0;
+            }
+        }
+      El::mpi::AllReduce(sums.data(), sums.size(), El::mpi::SUM,
+                         block_info.inter_node_comm.value);
+
+      size_t index(0);
+      plan.for_each_element(
+        Q.DistRank(), column_offset, column_end,
+        [&](const int64_t &row, const int64_t &column) {
+          Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column), sums[index]);
+          ++index;
+        });
+      synchronize_Q_buffers_timer.stop();
+      return;
     }
-  // Add the local contribution to the last message and put it into
-  // the global Q.
-
-  check_mpi_error(
-    MPI_Wait(&receive_requests[total_ranks % 2], MPI_STATUS_IGNORE));
-  El::byte *current_receiving(send_receive[total_ranks % 2].data());
-  for(int64_t row = 0; row < Q_group.Height(); ++row)
-    for(int64_t column = row; column < Q_group.Height(); ++column)
+
+  const int procs_per_node(block_info.procs_per_node),
+    num_nodes(total_ranks / procs_per_node);
+  if(procs_per_node == 1 || num_nodes == 1)
+    {
+      ring_reduce_scatter<const El::BigFloat *>(
+        block_info.solver_comm, rank_sizes, serialized_size,
+        [&](const int &destination,
+            std::vector<const El::BigFloat *> &contributions) {
+          local_contributions(plan, Q_group, column_offset, destination,
+                              contributions);
+        },
+        accumulator, scratch, mask, values);
+    }
+  else
+    {
+      // Reduce in two levels, so that only a fraction of the data has
+      // to leave the node.
+      //
+      // First, reduce within the node.  Each rank of the node sums
+      // the node's contributions for the elements of Q owned by the
+      // ranks with the same node-local rank on every node.
+      const int local_rank(rank % procs_per_node);
+      std::vector<int> node_sizes(procs_per_node, 0);
+      for(int world_rank = 0; world_rank < total_ranks; ++world_rank)
+        {
+          node_sizes[world_rank % procs_per_node] += rank_sizes[world_rank];
+        }
+      std::vector<El::byte> node_mask, node_values;
+      ring_reduce_scatter<const El::BigFloat *>(
+        block_info.node_comm.value, node_sizes, serialized_size,
+        [&](const int &destination,
+            std::vector<const El::BigFloat *> &contributions) {
+          for(int node = 0; node < num_nodes; ++node)
+            {
+              local_contributions(plan, Q_group, column_offset,
+                                  node * procs_per_node + destination,
+                                  contributions);
+            }
+        },
+        accumulator, scratch, node_mask, node_values);
+
+      // Then reduce those partial sums between nodes, only among the
+      // ranks with the same node-local rank.  Every rank ends up with
+      // the sums for its own elements, so nothing has to be scattered
+      // back afterwards.
+      std::vector<int> inter_node_sizes(num_nodes), offsets(num_nodes + 1, 0);
+      for(int node = 0; node < num_nodes; ++node)
+        {
+          inter_node_sizes[node]
+            = rank_sizes[node * procs_per_node + local_rank];
+          offsets[node + 1] = offsets[node] + inter_node_sizes[node];
+        }
+      std::vector<const El::byte *> partial_sums(offsets.back(), nullptr);
       {
-        if(Q.Owner(row, column) == rank)
+        const El::byte *current(node_values.data());
+        for(int index = 0; index < offsets.back(); ++index)
           {
-            El::BigFloat received;
-            received.Deserialize(current_receiving);
-            if(Q_group.IsLocal(row, column))
+            if(node_mask[index] != 0)
               {
-                received += Q_group.GetLocal(Q_group.LocalRow(row),
-                                             Q_group.LocalCol(column));
+                partial_sums[index] = current;
+                current += serialized_size;
               }
-            Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column), received);
-            current_receiving += serialized_size;
           }
       }
+      ring_reduce_scatter<const El::byte *>(
+        block_info.inter_node_comm.value, inter_node_sizes, serialized_size,
+        [&](const int &destination,
+            std::vector<const El::byte *> &contributions) {
+          contributions.insert(contributions.end(),
+                               partial_sums.begin() + offsets[destination],
+                               partial_sums.begin()
+                                 + offsets[destination + 1]);
+        },
+        accumulator, scratch, mask, values);
+    }
+
+  // Put the sums into the global Q.
+  const El::BigFloat zero(0);
+  size_t index(0);
+  const El::byte *current_receiving(values.data());
+  plan.for_each_element(
+    rank, column_offset, column_end,
+    [&](const int64_t &row, const int64_t &column) {
+      if(mask[index] != 0)
+        {
+          accumulator.Deserialize(current_receiving);
+          Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column), accumulator);
+          current_receiving += serialized_size;
+        }
+      else
+        {
+          Q.SetLocal(Q.LocalRow(row), Q.LocalCol(column), zero);
+        }
+      ++index;
+    });
   synchronize_Q_buffers_timer.stop();
 }
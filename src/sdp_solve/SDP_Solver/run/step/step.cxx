@@ -1,26 +1,30 @@
+#include "Iterative_Schur_Block.hxx"
 #include "../../../SDP_Solver.hxx"
 
-// Tr(A B), where A and B are symmetric
-El::BigFloat frobenius_product_symmetric(const Block_Diagonal_Matrix &A,
-                                         const Block_Diagonal_Matrix &B);
+std::vector<size_t>
+factored_schur_block_sizes(const SDP_Solver_Parameters &parameters,
+                           const Block_Info &block_info);
 
 void initialize_schur_complement_solver(
-  const Block_Info &block_info, const SDP &sdp,
+  const SDP_Solver_Parameters &parameters, const Block_Info &block_info,
+  const SDP &sdp,
   const Block_Diagonal_Matrix &bilinear_pairings_X_inv,
   const Block_Diagonal_Matrix &bilinear_pairings_Y, const El::Grid &block_grid,
   Block_Diagonal_Matrix &schur_complement_cholesky,
-  Block_Matrix &schur_off_diagonal, El::DistMatrix<El::BigFloat> &Q,
-  Timers &timers);
+  Block_Matrix &schur_off_diagonal,
+  std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
+  El::DistMatrix<El::BigFloat> &Q, Timers &timers);
 
 void compute_search_direction(
   const Block_Info &block_info, const SDP &sdp, const SDP_Solver &solver,
   const Block_Diagonal_Matrix &schur_complement_cholesky,
   const Block_Matrix &schur_off_diagonal,
+  const std::map<size_t, Iterative_Schur_Block> &iterative_schur_blocks,
   const Block_Diagonal_Matrix &X_cholesky, const El::BigFloat beta,
   const El::BigFloat &mu, const Block_Vector &primal_residue_p,
   const bool &is_corrector_phase, const El::DistMatrix<El::BigFloat> &Q,
-  Block_Vector &dx, Block_Diagonal_Matrix &dX, Block_Vector &dy,
-  Block_Diagonal_Matrix &dY);
+  const El::BigFloat &iterative_tolerance, Block_Vector &dx,
+  Block_Diagonal_Matrix &dX, Block_Vector &dy, Block_Diagonal_Matrix &dY);
 
 El::BigFloat
 predictor_centering_parameter(const SDP_Solver_Parameters &parameters,
@@ -30,27 +34,30 @@ El::BigFloat corrector_centering_parameter(
   const SDP_Solver_Parameters &parameters, const Block_Diagonal_Matrix &X,
   const Block_Diagonal_Matrix &dX, const Block_Diagonal_Matrix &Y,
   const Block_Diagonal_Matrix &dY, const El::BigFloat &mu,
-  const bool is_primal_dual_feasible, const size_t &total_num_rows);
+  const bool is_primal_dual_feasible, const size_t &total_num_rows,
+  const El::mpi::Comm &comm);
 
-El::BigFloat
-step_length(const Block_Diagonal_Matrix &MCholesky,
-            const Block_Diagonal_Matrix &dM, const El::BigFloat &gamma,
-            const std::string &timer_name, Timers &timers);
+void step_length(const size_t &replicated_factor_threshold,
+                 const Block_Diagonal_Matrix &X_cholesky,
+                 const Block_Diagonal_Matrix &dX,
+                 const Block_Diagonal_Matrix &Y_cholesky,
+                 const Block_Diagonal_Matrix &dY, const El::BigFloat &gamma,
+                 const El::mpi::Comm &comm, El::BigFloat &primal_step_length,
+                 El::BigFloat &dual_step_length, Timers &timers);
 
 void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
                       const std::size_t &total_psd_rows,
                       const bool &is_primal_and_dual_feasible,
                       const Block_Info &block_info, const SDP &sdp,
-                      const El::Grid &grid,
+                      const El::Grid &grid, const El::Grid &Q_grid,
                       const Block_Diagonal_Matrix &X_cholesky,
                       const Block_Diagonal_Matrix &Y_cholesky,
                       const Block_Diagonal_Matrix &bilinear_pairings_X_inv,
                       const Block_Diagonal_Matrix &bilinear_pairings_Y,
-                      const Block_Vector &primal_residue_p, El::BigFloat &mu,
-                      El::BigFloat &beta_corrector,
+                      const Block_Vector &primal_residue_p,
+                      const El::BigFloat &mu, El::BigFloat &beta_corrector,
                       El::BigFloat &primal_step_length,
-                      El::BigFloat &dual_step_length,
-                      bool &terminate_now, Timers &timers)
+                      El::BigFloat &dual_step_length, Timers &timers)
 {
   auto &step_timer(timers.add_and_start("run.step"));
   El::BigFloat beta_predictor;
@@ -62,15 +69,21 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
   Block_Diagonal_Matrix dX(X), dY(Y);
   {
     // SchurComplementCholesky = L', the Cholesky decomposition of the
-    // Schur complement matrix S.
+    // Schur complement matrix S.  Blocks that are solved iteratively
+    // are empty.
     Block_Diagonal_Matrix schur_complement_cholesky(
-      block_info.schur_block_sizes, block_info.block_indices,
-      block_info.schur_block_sizes.size(), grid);
+      factored_schur_block_sizes(parameters, block_info),
+      block_info.block_indices, block_info.schur_block_sizes.size(), grid);
 
     // SchurOffDiagonal = L'^{-1} FreeVarMatrix, needed in solving the
-    // Schur complement equation.
+    // Schur complement equation.  For blocks that are solved
+    // iteratively, SchurOffDiagonal = S^{-1} FreeVarMatrix.
     Block_Matrix schur_off_diagonal;
 
+    // The blocks of S that are solved iteratively, indexed by the
+    // local block number.
+    std::map<size_t, Iterative_Schur_Block> iterative_schur_blocks;
+
     // Q = B' L'^{-T} L'^{-1} B' - {{0, 0}, {0, 1}}, where B' =
     // (FreeVarMatrix U).  Q is needed in the factorization of the Schur
     // complement equation.  Q has dimension N'xN', where
@@ -78,26 +91,23 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
     //   N' = cols(B) + cols(U) = N + cols(U)
     //
     // where N is the dimension of the dual objective function.  Note
-    // that N' could change with each iteration.
-    El::DistMatrix<El::BigFloat> Q(sdp.dual_objective_b.Height(),
-                                   sdp.dual_objective_b.Height());
+    // that N' could change with each iteration.  Q is either spread
+    // over all processes, or replicated on each node (see
+    // use_node_local_Q).  If N' is larger than iterativeQThreshold, Q
+    // is left empty and never formed.
+    const int64_t Q_height(parameters.iterative_Q_threshold != 0
+                               && sdp.dual_objective_b.Height()
+                                    > int64_t(parameters.iterative_Q_threshold)
+                             ? 0
+                             : sdp.dual_objective_b.Height());
+    El::DistMatrix<El::BigFloat> Q(Q_height, Q_height, Q_grid);
 
     // Compute SchurComplement and prepare to solve the Schur
     // complement equation for dx, dy
     initialize_schur_complement_solver(
-      block_info, sdp, bilinear_pairings_X_inv, bilinear_pairings_Y, grid,
-      schur_complement_cholesky, schur_off_diagonal, Q, timers);
-
-    // Compute the complementarity mu = Tr(X Y)/X.dim
-    auto &frobenius_timer(
-      timers.add_and_start("run.step.frobenius_product_symmetric"));
-    mu = frobenius_product_symmetric(X, Y) / total_psd_rows;
-    frobenius_timer.stop();
-    if(mu > parameters.max_complementarity)
-      {
-        terminate_now = true;
-        return;
-      }
+      parameters, block_info, sdp, bilinear_pairings_X_inv,
+      bilinear_pairings_Y, grid, schur_complement_cholesky,
+      schur_off_diagonal, iterative_schur_blocks, Q, timers);
 
     auto &predictor_timer(
       timers.add_and_start("run.step.computeSearchDirection(betaPredictor)"));
@@ -106,8 +116,10 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
     beta_predictor
       = predictor_centering_parameter(parameters, is_primal_and_dual_feasible);
     compute_search_direction(block_info, sdp, *this, schur_complement_cholesky,
-                             schur_off_diagonal, X_cholesky, beta_predictor,
-                             mu, primal_residue_p, false, Q, dx, dX, dy, dY);
+                             schur_off_diagonal, iterative_schur_blocks,
+                             X_cholesky, beta_predictor, mu, primal_residue_p,
+                             false, Q, parameters.iterative_schur_tolerance,
+                             dx, dX, dy, dY);
     predictor_timer.stop();
 
     // Compute the corrector solution for (dx, dX, dy, dY)
@@ -115,21 +127,20 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
       timers.add_and_start("run.step.computeSearchDirection(betaCorrector)"));
     beta_corrector = corrector_centering_parameter(
       parameters, X, dX, Y, dY, mu, is_primal_and_dual_feasible,
-      total_psd_rows);
+      total_psd_rows, block_info.solver_comm);
 
     compute_search_direction(block_info, sdp, *this, schur_complement_cholesky,
-                             schur_off_diagonal, X_cholesky, beta_corrector,
-                             mu, primal_residue_p, true, Q, dx, dX, dy, dY);
+                             schur_off_diagonal, iterative_schur_blocks,
+                             X_cholesky, beta_corrector, mu, primal_residue_p,
+                             true, Q, parameters.iterative_schur_tolerance,
+                             dx, dX, dy, dY);
     corrector_timer.stop();
   }
   // Compute step-lengths that preserve positive definiteness of X, Y
-  primal_step_length
-    = step_length(X_cholesky, dX, parameters.step_length_reduction,
-                  "run.step.stepLength(XCholesky)", timers);
-
-  dual_step_length
-    = step_length(Y_cholesky, dY, parameters.step_length_reduction,
-                  "run.step.stepLength(YCholesky)", timers);
+  step_length(parameters.replicated_factor_threshold, X_cholesky, dX,
+              Y_cholesky, dY, parameters.step_length_reduction,
+              block_info.solver_comm, primal_step_length, dual_step_length,
+              timers);
 
   // If our problem is both dual-feasible and primal-feasible,
   // ensure we're following the true Newton direction.
@@ -142,7 +153,8 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
   // Update the primal point (x, X) += primalStepLength*(dx, dX)
   for(size_t block = 0; block < x.blocks.size(); ++block)
     {
-      El::Axpy(primal_step_length, dx.blocks[block], x.blocks[block]);
+      elementwise_axpy(primal_step_length, dx.blocks[block].LockedMatrix(),
+                       x.blocks[block].Matrix());
     }
   dX *= primal_step_length;
 
@@ -151,7 +163,8 @@ void SDP_Solver::step(const SDP_Solver_Parameters &parameters,
   // Update the dual point (y, Y) += dualStepLength*(dy, dY)
   for(size_t block = 0; block < dy.blocks.size(); ++block)
     {
-      El::Axpy(dual_step_length, dy.blocks[block], y.blocks[block]);
+      elementwise_axpy(dual_step_length, dy.blocks[block].LockedMatrix(),
+                       y.blocks[block].Matrix());
     }
   dY *= dual_step_length;
 
@@ -1,11 +1,34 @@
 #include "../../../../Block_Diagonal_Matrix.hxx"
 
+bool use_replicated_factor(const size_t &replicated_factor_threshold,
+                           const El::DistMatrix<El::BigFloat> &A);
+
 // A := L^{-1} A L^{-T}
-void lower_triangular_inverse_congruence(const Block_Diagonal_Matrix &L,
-                                         Block_Diagonal_Matrix &A)
+//
+// Blocks that use replicated factors (see cholesky_decomposition) are
+// gathered onto every process of the block's grid, and both solves
+// are done locally.
+void lower_triangular_inverse_congruence(
+  const size_t &replicated_factor_threshold, const Block_Diagonal_Matrix &L,
+  Block_Diagonal_Matrix &A)
 {
   for(size_t b = 0; b < A.blocks.size(); b++)
     {
+      if(use_replicated_factor(replicated_factor_threshold, L.blocks[b]))
+        {
+          const El::DistMatrix<El::BigFloat, El::STAR, El::STAR> L_star(
+            L.blocks[b]);
+          El::DistMatrix<El::BigFloat, El::STAR, El::STAR> A_star(
+            A.blocks[b]);
+          El::Trsm(El::LeftOrRight::RIGHT, El::UpperOrLowerNS::LOWER,
+                   El::Orientation::TRANSPOSE, El::UnitOrNonUnit::NON_UNIT,
+                   El::BigFloat(1), L_star.LockedMatrix(), A_star.Matrix());
+          El::Trsm(El::LeftOrRight::LEFT, El::UpperOrLowerNS::LOWER,
+                   El::Orientation::NORMAL, El::UnitOrNonUnit::NON_UNIT,
+                   El::BigFloat(1), L_star.LockedMatrix(), A_star.Matrix());
+          El::Copy(A_star, A.blocks[b]);
+          continue;
+        }
       El::Trsm(El::LeftOrRight::RIGHT, El::UpperOrLowerNS::LOWER,
                El::Orientation::TRANSPOSE, El::UnitOrNonUnit::NON_UNIT,
                El::BigFloat(1), L.blocks[b], A.blocks[b]);
@@ -1,6 +1,8 @@
 #include "../../../../Block_Diagonal_Matrix.hxx"
 
-// Minimum eigenvalue of A.  A is assumed to be symmetric.
+// Minimum eigenvalue of the blocks of A on this process.  A is
+// assumed to be symmetric.  The result still has to be combined with
+// the other processes.
 
 // Annoyingly, El::HermitianEig modifies 'block'.  It is OK, because
 // it is only called from step_length(), which passes in a temporary.
@@ -29,5 +31,5 @@ El::BigFloat min_eigenvalue(Block_Diagonal_Matrix &A)
                        hermitian_eig_ctrl);
       local_min = El::Min(local_min, El::Min(eigenvalues));
     }
-  return El::mpi::AllReduce(local_min, El::mpi::MIN, El::mpi::COMM_WORLD);
+  return local_min;
 }
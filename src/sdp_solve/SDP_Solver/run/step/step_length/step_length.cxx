@@ -9,40 +9,80 @@
 // + \alpha L^{-1} dM L^{-T}.  The correct \alpha is then -1/lambda,
 // where lambda is the smallest eigenvalue of L^{-1} dM L^{-T}.
 //
+// This computes the step lengths for both X and Y, so that the
+// eigenvalues can be combined across processes with a single
+// reduction.
+//
 // Inputs:
-// - MCholesky = L, the Cholesky decomposition of M (M itself is not needed)
-// - dM, a Block_Diagonal_Matrix with the same structure as M
+// - XCholesky, YCholesky = L, the Cholesky decompositions of X and Y
+//   (X and Y themselves are not needed)
+// - dX, dY, Block_Diagonal_Matrices with the same structure as X and Y
 // Workspace:
 // - MInvDM (NB: overwritten when computing minEigenvalue)
 // - eigenvalues, a Vector of eigenvalues for each block of M
 // Output:
-// - min(\gamma \alpha(M, dM), 1) (returned)
+// - min(\gamma \alpha(X, dX), 1) and min(\gamma \alpha(Y, dY), 1)
 
 // A := L^{-1} A L^{-T}
-void lower_triangular_inverse_congruence(const Block_Diagonal_Matrix &L,
-                                         Block_Diagonal_Matrix &A);
+void lower_triangular_inverse_congruence(
+  const size_t &replicated_factor_threshold, const Block_Diagonal_Matrix &L,
+  Block_Diagonal_Matrix &A);
 
 El::BigFloat min_eigenvalue(Block_Diagonal_Matrix &A);
 
-El::BigFloat step_length(const Block_Diagonal_Matrix &MCholesky,
-                         const Block_Diagonal_Matrix &dM,
-                         const El::BigFloat &gamma,
-                         const std::string &timer_name,
-                         Timers &timers)
+void fused_all_reduce(const El::mpi::Comm &comm,
+                      std::vector<Extended_Sum> &sums,
+                      std::vector<El::BigFloat> &maxes,
+                      std::vector<El::BigFloat> &mins);
+
+namespace
+{
+  El::BigFloat local_min_eigenvalue(const size_t &replicated_factor_threshold,
+                                    const Block_Diagonal_Matrix &MCholesky,
+                                    const Block_Diagonal_Matrix &dM,
+                                    const std::string &timer_name,
+                                    Timers &timers)
+  {
+    auto &step_length_timer(timers.add_and_start(timer_name));
+    // MInvDM = L^{-1} dM L^{-T}, where M = L L^T
+    Block_Diagonal_Matrix MInvDM(dM);
+    lower_triangular_inverse_congruence(replicated_factor_threshold,
+                                        MCholesky, MInvDM);
+    const El::BigFloat lambda(min_eigenvalue(MInvDM));
+    step_length_timer.stop();
+    return lambda;
+  }
+
+  El::BigFloat
+  step_length_from_eigenvalue(const El::BigFloat &lambda,
+                              const El::BigFloat &gamma)
+  {
+    if(lambda > -gamma)
+      {
+        return 1;
+      }
+    else
+      {
+        return -gamma / lambda;
+      }
+  }
+}
+
+void step_length(const size_t &replicated_factor_threshold,
+                 const Block_Diagonal_Matrix &X_cholesky,
+                 const Block_Diagonal_Matrix &dX,
+                 const Block_Diagonal_Matrix &Y_cholesky,
+                 const Block_Diagonal_Matrix &dY, const El::BigFloat &gamma,
+                 const El::mpi::Comm &comm, El::BigFloat &primal_step_length,
+                 El::BigFloat &dual_step_length, Timers &timers)
 {
-  auto &step_length_timer(
-        timers.add_and_start(timer_name));
-  // MInvDM = L^{-1} dM L^{-T}, where M = L L^T
-  Block_Diagonal_Matrix MInvDM(dM);
-  lower_triangular_inverse_congruence(MCholesky, MInvDM);
-  const El::BigFloat lambda(min_eigenvalue(MInvDM));
-  step_length_timer.stop();
-  if(lambda > -gamma)
-    {
-      return 1;
-    }
-  else
-    {
-      return -gamma / lambda;
-    }
+  std::vector<Extended_Sum> sums;
+  std::vector<El::BigFloat> maxes,
+    mins({local_min_eigenvalue(replicated_factor_threshold, X_cholesky, dX,
+                               "run.step.stepLength(XCholesky)", timers),
+          local_min_eigenvalue(replicated_factor_threshold, Y_cholesky, dY,
+                               "run.step.stepLength(YCholesky)", timers)});
+  fused_all_reduce(comm, sums, maxes, mins);
+  primal_step_length = step_length_from_eigenvalue(mins[0], gamma);
+  dual_step_length = step_length_from_eigenvalue(mins[1], gamma);
 }
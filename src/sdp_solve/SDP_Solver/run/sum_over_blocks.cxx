@@ -0,0 +1,31 @@
+#include "../../Block_Vector.hxx"
+
+// Sum the blocks of 'v' over all of the blocks on all of the
+// processes.  Every block of 'v' is a copy of the same height x 1
+// vector, and each element of a block is held by exactly one process
+// in the block's group.  So we add up the local elements and do a
+// single AllReduce of the dense vector.  This replaces queueing an
+// update for every element, which sends each nonzero element
+// separately.  The result is the complete sum, replicated on every
+// process.
+
+void sum_over_blocks(const Block_Vector &v, const int64_t &height,
+                     const El::mpi::Comm &comm,
+                     El::Matrix<El::BigFloat> &result)
+{
+  Zeros(result, height, 1);
+  for(auto &block : v.blocks)
+    {
+      const El::Matrix<El::BigFloat> &local(block.LockedMatrix());
+      for(int64_t row = 0; row < block.LocalHeight(); ++row)
+        {
+          const int64_t global_row(block.GlobalRow(row));
+          for(int64_t column = 0; column < block.LocalWidth(); ++column)
+            {
+              result(global_row, block.GlobalCol(column))
+                += local(row, column);
+            }
+        }
+    }
+  El::AllReduce(result, comm);
+}
@@ -0,0 +1,17 @@
+#include "../../SDP_Solver.hxx"
+
+// Whether to keep a full copy of Q on every node and factor it
+// redundantly with the processes on that node, rather than
+// distributing Q over all processes.  This is only done when asked
+// for with QCholeskyMode=node.  Which one is faster depends on the
+// size of Q, the precision, and the interconnect, so measure before
+// choosing 'node'.
+
+bool use_node_local_Q(const SDP_Solver_Parameters &parameters,
+                      const Block_Info &block_info)
+{
+  const size_t num_procs(El::mpi::Size(block_info.solver_comm)),
+    num_nodes(std::max(size_t(1), num_procs / block_info.procs_per_node));
+  // With one node, the two modes are the same.
+  return parameters.Q_cholesky_mode == "node" && num_nodes > 1;
+}
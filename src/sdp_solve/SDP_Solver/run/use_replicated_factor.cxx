@@ -0,0 +1,10 @@
+#include <El.hpp>
+
+// Whether to gather A onto every process of its grid before
+// factoring or solving with it (see replicatedFactorThreshold).
+bool use_replicated_factor(const size_t &replicated_factor_threshold,
+                           const El::DistMatrix<El::BigFloat> &A)
+{
+  return A.Grid().Size() > 1
+         && static_cast<size_t>(A.Height()) <= replicated_factor_threshold;
+}
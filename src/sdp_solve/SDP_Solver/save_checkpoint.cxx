@@ -34,7 +34,8 @@ void write_local_blocks(const T &t,
     }
 }
 
-void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters)
+void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters,
+                                 const Block_Info &block_info)
 {
   const boost::filesystem::path &checkpoint_directory(
     parameters.checkpoint_out);
@@ -53,14 +54,14 @@ void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters)
     {
       remove(checkpoint_directory
              / ("checkpoint_" + std::to_string(backup_generation.value()) + "_"
-                + std::to_string(El::mpi::Rank())));
+                + std::to_string(El::mpi::Rank(block_info.solver_comm))));
     }
   backup_generation = current_generation;
   current_generation += 1;
   boost::filesystem::path checkpoint_filename(
     checkpoint_directory
     / ("checkpoint_" + std::to_string(current_generation) + "_"
-       + std::to_string(El::mpi::Rank())));
+       + std::to_string(El::mpi::Rank(block_info.solver_comm))));
 
   const size_t max_retries(10);
   bool wrote_successfully(false);
@@ -68,7 +69,8 @@ void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters)
       ++attempt)
     {
       boost::filesystem::ofstream checkpoint_stream(checkpoint_filename);
-      if(parameters.verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
+      if(parameters.verbosity >= Verbosity::regular
+         && El::mpi::Rank(block_info.solver_comm) == 0)
         {
           std::cout << "Saving checkpoint to    : " << checkpoint_directory
                     << '\n';
@@ -98,7 +100,7 @@ void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters)
             }
         }
     }
-  if(El::mpi::Rank() == 0)
+  if(El::mpi::Rank(block_info.solver_comm) == 0)
     {
       boost::filesystem::ofstream metadata(checkpoint_directory
                                            / "checkpoint_new.json");
@@ -110,8 +112,8 @@ void SDP_Solver::save_checkpoint(const SDP_Solver_Parameters &parameters)
       boost::property_tree::write_json(metadata, to_property_tree(parameters));
       metadata << "}\n";
     }
-  El::mpi::Barrier(El::mpi::COMM_WORLD);
-  if(El::mpi::Rank() == 0)
+  El::mpi::Barrier(block_info.solver_comm);
+  if(El::mpi::Rank(block_info.solver_comm) == 0)
     {
       rename(checkpoint_directory / "checkpoint_new.json",
              checkpoint_directory / "checkpoint.json");
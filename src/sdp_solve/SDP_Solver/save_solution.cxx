@@ -36,14 +36,14 @@ void SDP_Solver::save_solution(
   const std::pair<std::string, Timer> &timer_pair,
   const boost::filesystem::path &out_directory,
   const Write_Solution &write_solution,
-  const std::vector<size_t> &block_indices, const Verbosity &verbosity) const
+  const Block_Info &block_info, const Verbosity &verbosity) const
 {
   // Internally, El::Print() sync's everything to the root core and
   // outputs it from there.  So do not actually open the file on
   // anything but the root node.
 
   boost::filesystem::ofstream out_stream;
-  if(El::mpi::Rank() == 0)
+  if(El::mpi::Rank(block_info.solver_comm) == 0)
     {
       if(verbosity >= Verbosity::regular)
         {
@@ -72,7 +72,7 @@ void SDP_Solver::save_solution(
     {
       const boost::filesystem::path y_path(out_directory / "y.txt");
       boost::filesystem::ofstream y_stream;
-      if(El::mpi::Rank() == 0)
+      if(El::mpi::Rank(block_info.solver_comm) == 0)
         {
           y_stream.open(y_path);
         }
@@ -80,7 +80,7 @@ void SDP_Solver::save_solution(
                 std::to_string(y.blocks.at(0).Height()) + " "
                   + std::to_string(y.blocks.at(0).Width()),
                 "\n", y_stream);
-      if(El::mpi::Rank() == 0)
+      if(El::mpi::Rank(block_info.solver_comm) == 0)
         {
           y_stream << "\n";
           if(!y_stream.good())
@@ -93,7 +93,7 @@ void SDP_Solver::save_solution(
 
   for(size_t block = 0; block != x.blocks.size(); ++block)
     {
-      size_t block_index(block_indices.at(block));
+      size_t block_index(block_info.block_indices.at(block));
       if(write_solution.vector_x)
         {
           const boost::filesystem::path x_path(
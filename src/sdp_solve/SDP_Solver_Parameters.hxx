@@ -16,19 +16,40 @@ struct SDP_Solver_Parameters
 {
   int64_t max_iterations, max_runtime, checkpoint_interval;
   bool no_final_checkpoint, find_primal_feasible, find_dual_feasible,
-    detect_primal_feasible_jump, detect_dual_feasible_jump;
+    detect_primal_feasible_jump, detect_dual_feasible_jump,
+    recompute_schur_off_diagonal, cache_iterative_schur_blocks,
+    calibrate_block_costs;
   bool require_initial_checkpoint = false;
-  size_t precision, procs_per_node, proc_granularity;
+  size_t precision, procs_per_node, proc_granularity, max_Q_memory,
+    iterative_schur_threshold, iterative_Q_threshold,
+    replicated_factor_threshold, algorithmic_block_size;
   Write_Solution write_solution;
   Verbosity verbosity;
 
   El::BigFloat duality_gap_threshold, primal_error_threshold,
     dual_error_threshold, initial_matrix_scale_primal,
     initial_matrix_scale_dual, feasible_centering_parameter,
-    infeasible_centering_parameter, step_length_reduction, max_complementarity;
+    infeasible_centering_parameter, step_length_reduction, max_complementarity,
+    iterative_schur_tolerance, infeasibility_threshold, warm_start_mu;
+
+  // How to factor Q: "distributed" or "node"
+  std::string Q_cholesky_mode;
 
   boost::filesystem::path sdp_directory, out_directory, checkpoint_in,
-    checkpoint_out, param_file;
+    checkpoint_out, warm_start_dir, param_file;
+
+  // Calibration of the analytical block cost model, used instead of a
+  // timing run
+  boost::filesystem::path block_cost_model;
+
+  // Objectives files to solve in sequence, reusing the rest of the SDP
+  std::vector<boost::filesystem::path> batch_objectives;
+
+  // SDP directories or objectives files to bisect over
+  std::vector<boost::filesystem::path> bisection_points;
+
+  // Independent SDP directories to solve alongside sdpDir
+  std::vector<boost::filesystem::path> packed_sdp_dirs;
 
   SDP_Solver_Parameters(int argc, char *argv[]);
   bool is_valid() const { return !sdp_directory.empty(); }
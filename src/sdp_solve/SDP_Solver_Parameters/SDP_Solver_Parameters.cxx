@@ -49,6 +49,44 @@ SDP_Solver_Parameters::SDP_Solver_Parameters(int argc, char *argv[])
     po::value<boost::filesystem::path>(&checkpoint_in),
     "The initial checkpoint directory to load. Defaults to "
     "checkpointDir.");
+  basic_options.add_options()(
+    "warmStartDir", po::value<boost::filesystem::path>(&warm_start_dir),
+    "If no checkpoint is found in initialCheckpointDir, start from the "
+    "checkpoint in this directory instead.  It should come from a closely "
+    "related SDP with the same block structure, run with the same number "
+    "of processes.  The loaded point is shifted toward the interior until "
+    "its complementarity is at least warmStartMu.");
+  basic_options.add_options()(
+    "batchObjectives",
+    po::value<std::vector<boost::filesystem::path>>(&batch_objectives)
+      ->multitoken(),
+    "A list of files, each in the same format as sdpDir/objectives.  "
+    "The constraints in sdpDir are read once, and the SDP is solved once "
+    "for each file, with that file's objective constant and b.  Each "
+    "solve starts from the previous solution, shifted as for "
+    "warmStartDir.  The results for the i'th file (counting from 0) go in "
+    "outDir/i and checkpointDir/i.");
+  basic_options.add_options()(
+    "bisectionPoints",
+    po::value<std::vector<boost::filesystem::path>>(&bisection_points)
+      ->multitoken(),
+    "A list of SDP directories with the same blocks as sdpDir, or "
+    "objectives files for sdpDir, ordered so that the result changes from "
+    "primal feasible to dual feasible (or back) at most once.  Bisect over "
+    "the list in a single run, starting each point from the previous "
+    "solution.  Use with findPrimalFeasible and findDualFeasible.  The "
+    "results for the i'th point go in outDir/i and checkpointDir/i, and the "
+    "boundary is written to outDir/bisection.txt.");
+  basic_options.add_options()(
+    "packedSdpDirs",
+    po::value<std::vector<boost::filesystem::path>>(&packed_sdp_dirs)
+      ->multitoken(),
+    "A list of independent SDP directories to solve in the same run as "
+    "sdpDir.  The nodes are split into groups sized by the predicted cost "
+    "of each SDP, and the groups solve different SDPs at the same time.  "
+    "When a group finishes, it takes the next unsolved SDP.  sdpDir is "
+    "SDP 0, and the i'th directory in the list is SDP i+1.  The results "
+    "for SDP i go in outDir/i, and its checkpoints in checkpointDir/i.");
   basic_options.add_options()(
     "checkpointInterval",
     po::value<int64_t>(&checkpoint_interval)->default_value(3600),
@@ -78,6 +116,80 @@ SDP_Solver_Parameters::SDP_Solver_Parameters(int argc, char *argv[])
     "longer.  "
     "This option is generally useful only when trying to fit a large problem "
     "in a small machine.");
+  basic_options.add_options()(
+    "blockCostModel", po::value<boost::filesystem::path>(&block_cost_model),
+    "A file with the calibration constants of the analytical block cost "
+    "model for this machine, in key=value format.  If there is no "
+    "block_timings file in checkpointDir or sdpDir, the blocks are "
+    "balanced with the costs predicted by the model, and the timing run "
+    "is skipped.  The predicted costs are written to "
+    "checkpointDir/block_timings.");
+  basic_options.add_options()(
+    "calibrateBlockCosts",
+    po::bool_switch(&calibrate_block_costs)->default_value(false),
+    "If there is no block_timings file in checkpointDir or sdpDir, "
+    "benchmark the Cholesky decomposition, triangular solve and update "
+    "of Q once for each distinct block size, instead of doing a timing "
+    "run.  The blocks are balanced with those timings, which are written "
+    "to checkpointDir/block_timings.");
+  basic_options.add_options()(
+    "maxQMemory", po::value<size_t>(&max_Q_memory)->default_value(0),
+    "The approximate amount of memory, in MiB, that each process may use "
+    "when computing and synchronizing the matrix Q.  If set, Q is built "
+    "one panel of columns at a time to stay within this limit.  This is "
+    "useful for problems with a large number of free variables.  0 means "
+    "no limit, so all of Q is built at once.");
+  basic_options.add_options()(
+    "QCholeskyMode",
+    po::value<std::string>(&Q_cholesky_mode)->default_value("distributed"s),
+    "How to compute the Cholesky decomposition of the matrix Q.  "
+    "'distributed' spreads Q over all processes.  'node' keeps a full copy "
+    "of Q on every node and factors it redundantly with the processes on "
+    "that node, which avoids global communication at the cost of more "
+    "memory and arithmetic per node.");
+  basic_options.add_options()(
+    "iterativeSchurThreshold",
+    po::value<size_t>(&iterative_schur_threshold)->default_value(0),
+    "Blocks of the Schur complement matrix with more rows than this are "
+    "never formed or factored.  Instead, they are solved with "
+    "preconditioned conjugate gradients, which needs much less memory for "
+    "very large blocks.  0 means that every block is factored.");
+  basic_options.add_options()(
+    "cacheIterativeSchurBlocks",
+    po::bool_switch(&cache_iterative_schur_blocks)->default_value(false),
+    "Keep the sub-blocks of the Schur complement blocks selected by "
+    "iterativeSchurThreshold, instead of recomputing them for every "
+    "product.  This is faster, but uses about half of the memory of those "
+    "blocks.");
+  basic_options.add_options()(
+    "iterativeQThreshold",
+    po::value<size_t>(&iterative_Q_threshold)->default_value(0),
+    "If the number of free variables is larger than this, the matrix Q is "
+    "never formed.  Instead, the equations involving Q are solved with "
+    "preconditioned conjugate gradients.  This allows problems with many "
+    "more free variables, but is usually slower.  0 means that Q is always "
+    "formed.");
+  basic_options.add_options()(
+    "recomputeSchurOffDiagonal",
+    po::bool_switch(&recompute_schur_off_diagonal)->default_value(false),
+    "Free the matrix L^{-1} B after computing Q, and recompute products "
+    "with it from B when solving for the search direction.  This saves "
+    "memory equal to the size of B, at the cost of extra triangular "
+    "solves.  This is most useful when there are many free variables.");
+  basic_options.add_options()(
+    "replicatedFactorThreshold",
+    po::value<size_t>(&replicated_factor_threshold)->default_value(0),
+    "Blocks that are split across more than one process and have at most "
+    "this many rows are gathered onto every process in their group before "
+    "Cholesky decompositions and triangular solves.  The factorization "
+    "then needs a single collective instead of many small messages, at the "
+    "cost of a full copy of the block on each process.  0 disables this.");
+  basic_options.add_options()(
+    "algorithmicBlockSize",
+    po::value<size_t>(&algorithmic_block_size)->default_value(0),
+    "Block size used by the distributed Cholesky decompositions and "
+    "triangular solves.  Larger values send fewer, larger messages.  0 "
+    "keeps Elemental's default.");
   basic_options.add_options()("verbosity",
                               po::value<int>(&int_verbosity)->default_value(1),
                               "Verbosity.  0 -> no output, 1 -> regular "
@@ -158,6 +270,13 @@ SDP_Solver_Parameters::SDP_Solver_Parameters(int argc, char *argv[])
       ->default_value(El::BigFloat("1e20", 10)),
     "The dual matrix Y begins at initialMatrixScaleDual times the "
     "identity matrix. Corresponds to SDPA's lambdaStar.");
+  solver_options.add_options()(
+    "warmStartMu",
+    po::value<El::BigFloat>(&warm_start_mu)
+      ->default_value(El::BigFloat("1e-10", 10)),
+    "When starting from warmStartDir, X and Y are shifted by multiples of "
+    "the identity until the complementarity mu = Tr(X Y)/dim(X) is at "
+    "least this value.");
   solver_options.add_options()(
     "feasibleCenteringParameter",
     po::value<El::BigFloat>(&feasible_centering_parameter)
@@ -183,6 +302,22 @@ SDP_Solver_Parameters::SDP_Solver_Parameters(int argc, char *argv[])
       ->default_value(El::BigFloat("1e100", 10)),
     "Terminate if the complementarity mu = Tr(X Y)/dim(X) "
     "exceeds this value.");
+  solver_options.add_options()(
+    "infeasibilityThreshold",
+    po::value<El::BigFloat>(&infeasibility_threshold)
+      ->default_value(El::BigFloat("0", 10)),
+    "Terminate with a certificate of primal (dual) infeasibility once the "
+    "dual (primal) point, divided by its objective, satisfies the "
+    "homogeneous constraints to within this relative error.  0 disables "
+    "this check.");
+
+  solver_options.add_options()(
+    "iterativeSchurTolerance",
+    po::value<El::BigFloat>(&iterative_schur_tolerance)
+      ->default_value(El::BigFloat("1e-60", 10)),
+    "Relative residual at which conjugate gradients stops for blocks "
+    "selected by iterativeSchurThreshold and for Q when selected by "
+    "iterativeQThreshold.");
 
   po::options_description cmd_line_options;
   cmd_line_options.add(required_options).add(basic_options).add(solver_options);
@@ -285,6 +420,42 @@ SDP_Solver_Parameters::SDP_Solver_Parameters(int argc, char *argv[])
                 }
             }
 
+          if(!batch_objectives.empty() && !bisection_points.empty())
+            {
+              throw std::runtime_error(
+                "batchObjectives and bisectionPoints can not be used "
+                "together.");
+            }
+          if(!packed_sdp_dirs.empty()
+             && (!batch_objectives.empty() || !bisection_points.empty()
+                 || !warm_start_dir.empty()))
+            {
+              throw std::runtime_error(
+                "packedSdpDirs can not be used together with "
+                "batchObjectives, bisectionPoints, or warmStartDir.");
+            }
+
+          if(calibrate_block_costs && !block_cost_model.empty())
+            {
+              throw std::runtime_error(
+                "calibrateBlockCosts and blockCostModel can not be used "
+                "together.");
+            }
+          if(!block_cost_model.empty()
+             && !boost::filesystem::exists(block_cost_model))
+            {
+              throw std::runtime_error("blockCostModel '"
+                                       + block_cost_model.string()
+                                       + "' does not exist");
+            }
+
+          if(Q_cholesky_mode != "distributed" && Q_cholesky_mode != "node")
+            {
+              throw std::runtime_error(
+                "Invalid value for QCholeskyMode: '" + Q_cholesky_mode
+                + "'.  Only 'distributed' or 'node' are allowed\n");
+            }
+
           if(int_verbosity != 0 && int_verbosity != 1 && int_verbosity != 2)
             {
               throw std::runtime_error(
@@ -6,12 +6,31 @@ std::ostream &operator<<(std::ostream &os, const SDP_Solver_Parameters &p)
      << "out directory   : " << p.out_directory << '\n'
      << "checkpoint in   : " << p.checkpoint_in << '\n'
      << "checkpoint out  : " << p.checkpoint_out << '\n'
+     << "warm start      : " << p.warm_start_dir << '\n'
+     << "block cost model: " << p.block_cost_model << '\n'
+     << "batch objectives:";
+  for(auto &objectives : p.batch_objectives)
+    {
+      os << ' ' << objectives;
+    }
+  os << '\n' << "bisection points:";
+  for(auto &point : p.bisection_points)
+    {
+      os << ' ' << point;
+    }
+  os << '\n' << "packed SDPs     :";
+  for(auto &directory : p.packed_sdp_dirs)
+    {
+      os << ' ' << directory;
+    }
+  os << '\n'
      << "\nParameters:\n"
      << std::boolalpha << "maxIterations                = " << p.max_iterations
      << '\n'
      << "maxRuntime                   = " << p.max_runtime << '\n'
      << "checkpointInterval           = " << p.checkpoint_interval << '\n'
      << "noFinalCheckpoint            = " << p.no_final_checkpoint << '\n'
+     << "calibrateBlockCosts          = " << p.calibrate_block_costs << '\n'
      << "writeSolution                = " << p.write_solution << '\n'
      << "findPrimalFeasible           = " << p.find_primal_feasible << '\n'
      << "findDualFeasible             = " << p.find_dual_feasible << '\n'
@@ -29,14 +48,30 @@ std::ostream &operator<<(std::ostream &os, const SDP_Solver_Parameters &p)
      << '\n'
      << "initialMatrixScaleDual       = " << p.initial_matrix_scale_dual
      << '\n'
+     << "warmStartMu                  = " << p.warm_start_mu << '\n'
      << "feasibleCenteringParameter   = " << p.feasible_centering_parameter
      << '\n'
      << "infeasibleCenteringParameter = " << p.infeasible_centering_parameter
      << '\n'
      << "stepLengthReduction          = " << p.step_length_reduction << '\n'
      << "maxComplementarity           = " << p.max_complementarity << '\n'
+     << "infeasibilityThreshold       = " << p.infeasibility_threshold << '\n'
+     << "iterativeSchurTolerance      = " << p.iterative_schur_tolerance
+     << '\n'
      << "procsPerNode                 = " << p.procs_per_node << '\n'
      << "procGranularity              = " << p.proc_granularity << '\n'
+     << "maxQMemory                   = " << p.max_Q_memory << '\n'
+     << "QCholeskyMode                = " << p.Q_cholesky_mode << '\n'
+     << "iterativeSchurThreshold      = " << p.iterative_schur_threshold
+     << '\n'
+     << "cacheIterativeSchurBlocks    = " << p.cache_iterative_schur_blocks
+     << '\n'
+     << "iterativeQThreshold          = " << p.iterative_Q_threshold << '\n'
+     << "recomputeSchurOffDiagonal    = " << p.recompute_schur_off_diagonal
+     << '\n'
+     << "replicatedFactorThreshold    = " << p.replicated_factor_threshold
+     << '\n'
+     << "algorithmicBlockSize         = " << p.algorithmic_block_size << '\n'
      << "verbosity                    = " << static_cast<int>(p.verbosity)
      << '\n';
   return os;
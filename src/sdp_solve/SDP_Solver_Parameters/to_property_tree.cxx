@@ -9,10 +9,43 @@ to_property_tree(const SDP_Solver_Parameters &p)
   result.put("outDir", p.out_directory.string());
   result.put("initialCheckpointDir", p.checkpoint_in.string());
   result.put("checkpointDir", p.checkpoint_out.string());
+  result.put("warmStartDir", p.warm_start_dir.string());
+  result.put("blockCostModel", p.block_cost_model.string());
+  {
+    boost::property_tree::ptree batch_objectives;
+    for(auto &objectives : p.batch_objectives)
+      {
+        boost::property_tree::ptree element;
+        element.put("", objectives.string());
+        batch_objectives.push_back(std::make_pair("", element));
+      }
+    result.add_child("batchObjectives", batch_objectives);
+  }
+  {
+    boost::property_tree::ptree bisection_points;
+    for(auto &point : p.bisection_points)
+      {
+        boost::property_tree::ptree element;
+        element.put("", point.string());
+        bisection_points.push_back(std::make_pair("", element));
+      }
+    result.add_child("bisectionPoints", bisection_points);
+  }
+  {
+    boost::property_tree::ptree packed_sdp_dirs;
+    for(auto &directory : p.packed_sdp_dirs)
+      {
+        boost::property_tree::ptree element;
+        element.put("", directory.string());
+        packed_sdp_dirs.push_back(std::make_pair("", element));
+      }
+    result.add_child("packedSdpDirs", packed_sdp_dirs);
+  }
   result.put("maxIterations", p.max_iterations);
   result.put("maxRuntime", p.max_runtime);
   result.put("checkpointInterval", p.checkpoint_interval);
   result.put("noFinalCheckpoint", p.no_final_checkpoint);
+  result.put("calibrateBlockCosts", p.calibrate_block_costs);
   result.put("writeSolution", p.write_solution);
   result.put("findPrimalFeasible", p.find_primal_feasible);
   result.put("findDualFeasible", p.find_dual_feasible);
@@ -25,12 +58,23 @@ to_property_tree(const SDP_Solver_Parameters &p)
   result.put("dualErrorThreshold", p.dual_error_threshold);
   result.put("initialMatrixScalePrimal", p.initial_matrix_scale_primal);
   result.put("initialMatrixScaleDual", p.initial_matrix_scale_dual);
+  result.put("warmStartMu", p.warm_start_mu);
   result.put("feasibleCenteringParameter", p.feasible_centering_parameter);
   result.put("infeasibleCenteringParameter", p.infeasible_centering_parameter);
   result.put("stepLengthReduction", p.step_length_reduction);
   result.put("maxComplementarity", p.max_complementarity);
+  result.put("infeasibilityThreshold", p.infeasibility_threshold);
+  result.put("iterativeSchurTolerance", p.iterative_schur_tolerance);
   result.put("procsPerNode", p.procs_per_node);
   result.put("procGranularity", p.proc_granularity);
+  result.put("maxQMemory", p.max_Q_memory);
+  result.put("QCholeskyMode", p.Q_cholesky_mode);
+  result.put("iterativeSchurThreshold", p.iterative_schur_threshold);
+  result.put("cacheIterativeSchurBlocks", p.cache_iterative_schur_blocks);
+  result.put("iterativeQThreshold", p.iterative_Q_threshold);
+  result.put("recomputeSchurOffDiagonal", p.recompute_schur_off_diagonal);
+  result.put("replicatedFactorThreshold", p.replicated_factor_threshold);
+  result.put("algorithmicBlockSize", p.algorithmic_block_size);
   result.put("verbosity", static_cast<int>(p.verbosity));
 
   return result;
@@ -29,6 +29,12 @@ operator<<(std::ostream &os, const SDP_Solver_Terminate_Reason &r)
     case SDP_Solver_Terminate_Reason::MaxComplementarityExceeded:
       os << "maxComplementarity exceeded";
       break;
+    case SDP_Solver_Terminate_Reason::PrimalInfeasible:
+      os << "found primal infeasibility certificate";
+      break;
+    case SDP_Solver_Terminate_Reason::DualInfeasible:
+      os << "found dual infeasibility certificate";
+      break;
     }
   return os;
 }
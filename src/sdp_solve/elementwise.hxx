@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Extended_Sum.hxx"
+
+#include <El.hpp>
+
+// Elementwise operations on the local data of BigFloat matrices.
+//
+// El's versions of these work one BigFloat operation at a time, and
+// each product creates and destroys a temporary BigFloat, which
+// allocates and frees its limbs.  These kernels call GMP's mpf
+// functions directly on each element, with one scratch mpf_t per
+// call.  The limb loops inside GMP are already vectorized, and GMP
+// picks the fastest version for the CPU at runtime when built with
+// --enable-fat.
+//
+// The matrices must all have the same local shape.  For DistMatrices,
+// pass the local matrices of identically distributed matrices.
+
+// Y += alpha X
+void elementwise_axpy(const El::BigFloat &alpha,
+                      const El::Matrix<El::BigFloat> &X,
+                      El::Matrix<El::BigFloat> &Y);
+
+// Y *= alpha
+void elementwise_scale(const El::BigFloat &alpha, El::Matrix<El::BigFloat> &Y);
+
+// Y += alpha (A o B), where 'o' is the Hadamard product
+void elementwise_hadamard_axpy(const El::BigFloat &alpha,
+                               const El::Matrix<El::BigFloat> &A,
+                               const El::Matrix<El::BigFloat> &B,
+                               El::Matrix<El::BigFloat> &Y);
+
+// sum += \sum_{i,j} A(i,j) B(i,j)
+void elementwise_dotu(const El::Matrix<El::BigFloat> &A,
+                      const El::Matrix<El::BigFloat> &B, Extended_Sum &sum);
+
+// sum += \sum_{i,j} (A(i,j) + dA(i,j)) (B(i,j) + dB(i,j))
+void elementwise_dotu_of_sums(const El::Matrix<El::BigFloat> &A,
+                              const El::Matrix<El::BigFloat> &dA,
+                              const El::Matrix<El::BigFloat> &B,
+                              const El::Matrix<El::BigFloat> &dB,
+                              Extended_Sum &sum);
+
+// Add c to the diagonal elements of A that are stored on this process
+void elementwise_shift_diagonal(const El::BigFloat &c,
+                                El::DistMatrix<El::BigFloat> &A);
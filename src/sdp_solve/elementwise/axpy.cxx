@@ -0,0 +1,33 @@
+#include "../elementwise.hxx"
+
+void elementwise_axpy(const El::BigFloat &alpha,
+                      const El::Matrix<El::BigFloat> &X,
+                      El::Matrix<El::BigFloat> &Y)
+{
+  // Adding and subtracting are common enough to skip the product.
+  const bool is_one(alpha == El::BigFloat(1)),
+    is_minus_one(alpha == El::BigFloat(-1));
+  mpf_srcptr alpha_mpf(alpha.gmp_float.get_mpf_t());
+  mpf_t product;
+  mpf_init(product);
+  for(int64_t column = 0; column < Y.Width(); ++column)
+    for(int64_t row = 0; row < Y.Height(); ++row)
+      {
+        mpf_ptr y(Y(row, column).gmp_float.get_mpf_t());
+        mpf_srcptr x(X(row, column).gmp_float.get_mpf_t());
+        if(is_one)
+          {
+            mpf_add(y, y, x);
+          }
+        else if(is_minus_one)
+          {
+            mpf_sub(y, y, x);
+          }
+        else
+          {
+            mpf_mul(product, alpha_mpf, x);
+            mpf_add(y, y, product);
+          }
+      }
+  mpf_clear(product);
+}
@@ -0,0 +1,11 @@
+#include "../elementwise.hxx"
+
+void elementwise_dotu(const El::Matrix<El::BigFloat> &A,
+                      const El::Matrix<El::BigFloat> &B, Extended_Sum &sum)
+{
+  for(int64_t column = 0; column < A.Width(); ++column)
+    for(int64_t row = 0; row < A.Height(); ++row)
+      {
+        sum.add_product(A(row, column), B(row, column));
+      }
+}
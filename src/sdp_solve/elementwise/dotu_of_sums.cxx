@@ -0,0 +1,15 @@
+#include "../elementwise.hxx"
+
+void elementwise_dotu_of_sums(const El::Matrix<El::BigFloat> &A,
+                              const El::Matrix<El::BigFloat> &dA,
+                              const El::Matrix<El::BigFloat> &B,
+                              const El::Matrix<El::BigFloat> &dB,
+                              Extended_Sum &sum)
+{
+  for(int64_t column = 0; column < A.Width(); ++column)
+    for(int64_t row = 0; row < A.Height(); ++row)
+      {
+        sum.add_product_of_sums(A(row, column), dA(row, column),
+                                B(row, column), dB(row, column));
+      }
+}
@@ -0,0 +1,21 @@
+#include "../elementwise.hxx"
+
+void elementwise_hadamard_axpy(const El::BigFloat &alpha,
+                               const El::Matrix<El::BigFloat> &A,
+                               const El::Matrix<El::BigFloat> &B,
+                               El::Matrix<El::BigFloat> &Y)
+{
+  mpf_srcptr alpha_mpf(alpha.gmp_float.get_mpf_t());
+  mpf_t product;
+  mpf_init(product);
+  for(int64_t column = 0; column < Y.Width(); ++column)
+    for(int64_t row = 0; row < Y.Height(); ++row)
+      {
+        mpf_ptr y(Y(row, column).gmp_float.get_mpf_t());
+        mpf_mul(product, A(row, column).gmp_float.get_mpf_t(),
+                B(row, column).gmp_float.get_mpf_t());
+        mpf_mul(product, product, alpha_mpf);
+        mpf_add(y, y, product);
+      }
+  mpf_clear(product);
+}
@@ -0,0 +1,12 @@
+#include "../elementwise.hxx"
+
+void elementwise_scale(const El::BigFloat &alpha, El::Matrix<El::BigFloat> &Y)
+{
+  mpf_srcptr alpha_mpf(alpha.gmp_float.get_mpf_t());
+  for(int64_t column = 0; column < Y.Width(); ++column)
+    for(int64_t row = 0; row < Y.Height(); ++row)
+      {
+        mpf_ptr y(Y(row, column).gmp_float.get_mpf_t());
+        mpf_mul(y, y, alpha_mpf);
+      }
+}
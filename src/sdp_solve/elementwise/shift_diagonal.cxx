@@ -0,0 +1,18 @@
+#include "../elementwise.hxx"
+
+void elementwise_shift_diagonal(const El::BigFloat &c,
+                                El::DistMatrix<El::BigFloat> &A)
+{
+  mpf_srcptr c_mpf(c.gmp_float.get_mpf_t());
+  El::Matrix<El::BigFloat> &A_local(A.Matrix());
+  for(int64_t column = 0; column < A.LocalWidth(); ++column)
+    {
+      const int64_t global_column(A.GlobalCol(column));
+      if(global_column < A.Height() && A.IsLocalRow(global_column))
+        {
+          mpf_ptr a(A_local(A.LocalRow(global_column), column)
+                      .gmp_float.get_mpf_t());
+          mpf_add(a, a, c_mpf);
+        }
+    }
+}
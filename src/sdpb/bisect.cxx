@@ -0,0 +1,234 @@
+#include "../sdp_solve.hxx"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <memory>
+
+Timers run_from_previous(const Block_Info &block_info,
+                         const SDP_Solver_Parameters &parameters,
+                         const size_t &index, const bool &is_first,
+                         const SDP &sdp, const El::Grid &grid,
+                         SDP_Solver &solver,
+                         SDP_Solver_Terminate_Reason &reason);
+
+void set_objectives(const boost::filesystem::path &objectives_path,
+                    const El::Grid &grid, SDP &sdp);
+
+void check_block_structure(const Block_Info &block_info,
+                           const boost::filesystem::path &sdp_directory);
+
+// Bisect over the list of bisectionPoints in a single job.  Each
+// point is either an SDP directory with the same blocks as sdpDir, or
+// an objectives file for the SDP in sdpDir.  The result at each point
+// is on the primal side (a primal feasible point, a primal jump, or a
+// certificate of dual infeasibility) or on the dual side.  Assuming
+// the side changes at most once along the list, this finds the two
+// neighboring points where it changes, solving about log2(N) points.
+// A point with neither result (e.g. maxIterations exceeded) is
+// inconclusive.  The bisection then stops, and bisection.txt records
+// the point and the boundary found so far.
+//
+// Block_Info, the grid and the solver are set up once.  The SDP is
+// only read again when a point is in a different directory than the
+// previous point, and each point starts from the solution of the
+// previous one.
+
+namespace
+{
+  // Whether a point is on the primal side, or none if its result is
+  // inconclusive.
+  boost::optional<bool>
+  is_primal_side(const SDP_Solver_Terminate_Reason &reason)
+  {
+    switch(reason)
+      {
+      case SDP_Solver_Terminate_Reason::PrimalFeasible:
+      case SDP_Solver_Terminate_Reason::PrimalFeasibleJumpDetected:
+      case SDP_Solver_Terminate_Reason::DualInfeasible: return true;
+      case SDP_Solver_Terminate_Reason::DualFeasible:
+      case SDP_Solver_Terminate_Reason::DualFeasibleJumpDetected:
+      case SDP_Solver_Terminate_Reason::PrimalInfeasible: return false;
+      default: return boost::none;
+      }
+  }
+
+  std::string
+  side_name(const boost::optional<SDP_Solver_Terminate_Reason> &reason)
+  {
+    if(!reason)
+      {
+        return "\"unsolved\"";
+      }
+    const boost::optional<bool> primal_side(is_primal_side(reason.value()));
+    if(!primal_side)
+      {
+        return "\"inconclusive\"";
+      }
+    return primal_side.value() ? "\"primal\"" : "\"dual\"";
+  }
+}
+
+Timers
+bisect(const Block_Info &block_info, const SDP_Solver_Parameters &parameters)
+{
+  const std::vector<boost::filesystem::path> &points(
+    parameters.bisection_points);
+  El::Grid grid(block_info.mpi_comm.value);
+  Timers timers(parameters.verbosity >= Verbosity::debug);
+
+  std::unique_ptr<SDP> sdp;
+  std::unique_ptr<SDP_Solver> solver;
+  boost::filesystem::path sdp_directory;
+  int64_t dual_objective_b_height(0);
+  std::vector<boost::optional<SDP_Solver_Terminate_Reason>> reasons(
+    points.size());
+
+  auto solve_point([&](const size_t &index) {
+    const boost::filesystem::path &point(points[index]);
+    const bool is_directory(boost::filesystem::is_directory(point));
+    const boost::filesystem::path directory(
+      is_directory ? point : parameters.sdp_directory);
+    if(parameters.verbosity >= Verbosity::regular
+       && El::mpi::Rank(block_info.solver_comm) == 0)
+      {
+        std::cout << "Solving bisection point : " << point << '\n';
+      }
+    if(!sdp || directory != sdp_directory)
+      {
+        check_block_structure(block_info, directory);
+        // Free the old SDP first, so that there is only ever one in
+        // memory.
+        sdp.reset();
+        sdp.reset(new SDP(directory, block_info, grid));
+        sdp_directory = directory;
+        if(solver && sdp->dual_objective_b.Height() != dual_objective_b_height)
+          {
+            throw std::runtime_error(
+              "Incompatible SDP in " + directory.string()
+              + ".  b has a different length than for the previous point.");
+          }
+      }
+    // An earlier point may have replaced the objectives of this SDP.
+    set_objectives(is_directory ? directory / "objectives" : point, grid,
+                   *sdp);
+
+    const bool is_first(!solver);
+    if(is_first)
+      {
+        dual_objective_b_height = sdp->dual_objective_b.Height();
+        solver.reset(new SDP_Solver(parameters, block_info, grid,
+                                    dual_objective_b_height));
+      }
+    SDP_Solver_Terminate_Reason reason;
+    timers = run_from_previous(block_info, parameters, index, is_first,
+                               *sdp, grid, *solver, reason);
+    reasons[index] = reason;
+    return is_primal_side(reason);
+  });
+
+  // If a point is inconclusive, the bisection stops there, keeping the
+  // boundary found so far.
+  size_t low(0), high(points.size() - 1);
+  boost::optional<size_t> inconclusive;
+  const boost::optional<bool> low_side(solve_point(low));
+  boost::optional<bool> high_side(low_side);
+  if(!low_side)
+    {
+      inconclusive = low;
+    }
+  else if(high != low)
+    {
+      high_side = solve_point(high);
+      if(!high_side)
+        {
+          inconclusive = high;
+        }
+    }
+  const bool is_bracketed(!inconclusive && low_side != high_side);
+  if(is_bracketed)
+    {
+      while(high - low > 1)
+        {
+          const size_t middle(low + (high - low) / 2);
+          const boost::optional<bool> middle_side(solve_point(middle));
+          if(!middle_side)
+            {
+              inconclusive = middle;
+              break;
+            }
+          if(middle_side == low_side)
+            {
+              low = middle;
+            }
+          else
+            {
+              high = middle;
+            }
+        }
+    }
+
+  if(El::mpi::Rank(block_info.solver_comm) == 0)
+    {
+      const boost::filesystem::path bisection_path(parameters.out_directory
+                                                   / "bisection.txt");
+      boost::filesystem::ofstream bisection_stream(bisection_path);
+      bisection_stream << "firstSide = " << side_name(reasons.front())
+                       << ";\n"
+                       << "lastSide  = " << side_name(reasons.back())
+                       << ";\n"
+                       << "boundary  = {";
+      if(is_bracketed)
+        {
+          bisection_stream << low << ", " << high;
+        }
+      bisection_stream << "};\n"
+                       << "inconclusive = {";
+      if(inconclusive)
+        {
+          bisection_stream << inconclusive.value();
+        }
+      bisection_stream << "};\n"
+                       << "results   = {";
+      bool is_first(true);
+      for(size_t index = 0; index < points.size(); ++index)
+        {
+          if(reasons[index])
+            {
+              bisection_stream << (is_first ? "" : ",") << "\n  {" << index
+                               << ", " << points[index] << ", \""
+                               << reasons[index].value() << "\"}";
+              is_first = false;
+            }
+        }
+      bisection_stream << "\n};\n";
+      if(!bisection_stream.good())
+        {
+          throw std::runtime_error("Error when writing to: "
+                                   + bisection_path.string());
+        }
+      if(parameters.verbosity >= Verbosity::regular)
+        {
+          if(inconclusive)
+            {
+              std::cout << "Bisection stopped at inconclusive point "
+                        << points[inconclusive.value()] << '\n';
+            }
+          std::cout << "Bisection boundary      : ";
+          if(is_bracketed)
+            {
+              std::cout << points[low] << " " << points[high] << '\n';
+            }
+          else if(inconclusive)
+            {
+              std::cout << "none\n";
+            }
+          else
+            {
+              std::cout << "none, every point is on the "
+                        << side_name(reasons.front()) << " side\n";
+            }
+        }
+    }
+  return timers;
+}
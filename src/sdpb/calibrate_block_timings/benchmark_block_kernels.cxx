@@ -0,0 +1,78 @@
+#include <El.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+// Time the Cholesky decomposition of a Schur complement block, the
+// solve with the free variable matrix, and the update of Q, on this
+// process alone.  Blocks and free variable counts larger than
+// max_benchmark_size are timed at max_benchmark_size, and the time is
+// scaled up with the operation counts
+//
+//   Cholesky: s^3/3,  Trsm: s^2 N,  Syrk: s N^2/2.
+//
+// The result is in milliseconds, like the timings of a timing run.
+
+namespace
+{
+  const size_t max_benchmark_size(128);
+
+  double elapsed_milliseconds(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &start)
+  {
+    return std::chrono::duration<double, std::milli>(
+             std::chrono::high_resolution_clock::now() - start)
+      .count();
+  }
+}
+
+double benchmark_block_kernels(const size_t &schur_size,
+                               const size_t &num_free_vars)
+{
+  const size_t size(std::max(size_t(1),
+                             std::min(schur_size, max_benchmark_size))),
+    width(std::max(size_t(1), std::min(num_free_vars, max_benchmark_size)));
+
+  // Arithmetic with zeros is much faster with extended precision, so
+  // every entry is nonzero.  The diagonal shift makes the block
+  // positive definite.
+  El::Matrix<El::BigFloat> schur(size, size), free_var(size, width),
+    Q(width, width);
+  for(size_t row = 0; row < size; ++row)
+    {
+      for(size_t column = 0; column < size; ++column)
+        {
+          schur(row, column)
+            = El::BigFloat(1) / El::BigFloat(row + column + 1);
+        }
+      schur(row, row) += El::BigFloat(size);
+      for(size_t column = 0; column < width; ++column)
+        {
+          free_var(row, column)
+            = El::BigFloat(1) / El::BigFloat(row + 2 * column + 1);
+        }
+    }
+  El::Zero(Q);
+
+  auto start(std::chrono::high_resolution_clock::now());
+  El::Cholesky(El::UpperOrLowerNS::LOWER, schur);
+  const double cholesky_time(elapsed_milliseconds(start));
+
+  start = std::chrono::high_resolution_clock::now();
+  El::Trsm(El::LeftOrRightNS::LEFT, El::UpperOrLowerNS::LOWER,
+           El::OrientationNS::NORMAL, El::UnitOrNonUnitNS::NON_UNIT,
+           El::BigFloat(1), schur, free_var);
+  const double trsm_time(elapsed_milliseconds(start));
+
+  start = std::chrono::high_resolution_clock::now();
+  El::Syrk(El::UpperOrLowerNS::LOWER, El::OrientationNS::TRANSPOSE,
+           El::BigFloat(1), free_var, El::BigFloat(0), Q);
+  const double syrk_time(elapsed_milliseconds(start));
+
+  const double size_ratio(schur_size / double(size)),
+    width_ratio(num_free_vars / double(width));
+  return size_ratio
+         * (cholesky_time * size_ratio * size_ratio
+            + trsm_time * size_ratio * width_ratio
+            + syrk_time * width_ratio * width_ratio);
+}
@@ -0,0 +1,70 @@
+#include "../../sdp_solve.hxx"
+
+#include <boost/filesystem.hpp>
+
+#include <cmath>
+#include <limits>
+#include <map>
+
+double benchmark_block_kernels(const size_t &schur_size,
+                               const size_t &num_free_vars);
+
+size_t read_num_free_vars(const boost::filesystem::path &sdp_directory);
+
+void write_block_timings(const boost::filesystem::path &checkpoint_out,
+                         const El::mpi::Comm &comm,
+                         const El::Matrix<int32_t> &block_timings);
+
+// Instead of running two full iterations, benchmark the kernels that
+// the timing run measures (Cholesky, Trsm and Syrk) once for each
+// distinct size of Schur complement block.  There are usually only a
+// few distinct sizes, even with many blocks.  The sizes are spread
+// over all of the processes, which benchmark them at the same time.
+// The timings are saved in checkpointDir, as for a timing run.
+
+void calibrate_block_timings(const SDP_Solver_Parameters &parameters,
+                             const Block_Info &block_info,
+                             El::Matrix<int32_t> &block_timings)
+{
+  const El::mpi::Comm &comm(block_info.solver_comm);
+  const size_t num_free_vars(read_num_free_vars(parameters.sdp_directory));
+
+  // std::map is sorted, so every rank numbers the sizes the same way.
+  std::map<size_t, size_t> size_indices;
+  for(auto &size : block_info.schur_block_sizes)
+    {
+      size_indices.emplace(size, 0);
+    }
+  std::vector<size_t> sizes;
+  for(auto &size_index : size_indices)
+    {
+      size_index.second = sizes.size();
+      sizes.push_back(size_index.first);
+    }
+  if(parameters.verbosity >= Verbosity::regular && El::mpi::Rank(comm) == 0)
+    {
+      std::cout << "Benchmarking " << sizes.size()
+                << " distinct block sizes\n";
+    }
+
+  El::Matrix<double> size_timings(sizes.size(), 1);
+  El::Zero(size_timings);
+  const size_t rank(El::mpi::Rank(comm)), num_procs(El::mpi::Size(comm));
+  for(size_t index = rank; index < sizes.size(); index += num_procs)
+    {
+      size_timings(index, 0)
+        = benchmark_block_kernels(sizes[index], num_free_vars);
+    }
+  El::AllReduce(size_timings, comm);
+
+  const double max_timing(std::numeric_limits<int32_t>::max());
+  block_timings.Resize(block_info.schur_block_sizes.size(), 1);
+  for(size_t block = 0; block < block_info.schur_block_sizes.size(); ++block)
+    {
+      const double milliseconds(size_timings(
+        size_indices.at(block_info.schur_block_sizes[block]), 0));
+      block_timings(block, 0)
+        = static_cast<int32_t>(std::min(std::ceil(milliseconds), max_timing));
+    }
+  write_block_timings(parameters.checkpoint_out, comm, block_timings);
+}
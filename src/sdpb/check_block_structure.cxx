@@ -0,0 +1,76 @@
+#include "../sdp_solve.hxx"
+
+#include <boost/filesystem/fstream.hpp>
+
+// Throw unless the SDP in sdp_directory has the same blocks as
+// block_info: the same dimensions m_j, degrees d_j, and PSD matrix
+// sizes.  Only the small blocks.* files are read, so this is cheap
+// compared to loading the SDP.
+
+void check_block_structure(const Block_Info &block_info,
+                           const boost::filesystem::path &sdp_directory)
+{
+  std::vector<size_t> dimensions(block_info.dimensions.size()),
+    degrees(block_info.degrees.size()),
+    psd_matrix_block_sizes(block_info.psd_matrix_block_sizes.size());
+  size_t num_blocks(0), file_rank(0), file_num_procs(0);
+  do
+    {
+      const boost::filesystem::path block_path(
+        sdp_directory / ("blocks." + std::to_string(file_rank)));
+      boost::filesystem::ifstream block_stream(block_path);
+      if(!block_stream.good())
+        {
+          throw std::runtime_error("Could not open '" + block_path.string()
+                                   + "'");
+        }
+      block_stream >> file_num_procs;
+      if(!block_stream.good())
+        {
+          throw std::runtime_error("Corrupted file: " + block_path.string());
+        }
+      std::vector<size_t> file_block_indices, file_dimensions, file_degrees,
+        file_schur_block_sizes, file_psd_matrix_block_sizes;
+      read_vector(block_stream, file_block_indices);
+      read_vector(block_stream, file_dimensions);
+      read_vector(block_stream, file_degrees);
+      read_vector(block_stream, file_schur_block_sizes);
+      read_vector(block_stream, file_psd_matrix_block_sizes);
+      if(file_dimensions.size() != file_block_indices.size()
+         || file_degrees.size() != file_block_indices.size()
+         || file_psd_matrix_block_sizes.size()
+              != 2 * file_block_indices.size())
+        {
+          throw std::runtime_error("Corrupted file: " + block_path.string());
+        }
+
+      for(size_t index = 0; index < file_block_indices.size(); ++index)
+        {
+          const size_t block(file_block_indices[index]);
+          if(block >= dimensions.size())
+            {
+              throw std::runtime_error(
+                "Incompatible SDP in " + sdp_directory.string()
+                + ".  It has more blocks than the first SDP.");
+            }
+          dimensions[block] = file_dimensions[index];
+          degrees[block] = file_degrees[index];
+          psd_matrix_block_sizes[2 * block]
+            = file_psd_matrix_block_sizes[2 * index];
+          psd_matrix_block_sizes[2 * block + 1]
+            = file_psd_matrix_block_sizes[2 * index + 1];
+          ++num_blocks;
+        }
+      ++file_rank;
+    }
+  while(file_rank < file_num_procs);
+
+  if(num_blocks != block_info.dimensions.size()
+     || dimensions != block_info.dimensions || degrees != block_info.degrees
+     || psd_matrix_block_sizes != block_info.psd_matrix_block_sizes)
+    {
+      throw std::runtime_error("Incompatible SDP in " + sdp_directory.string()
+                               + ".  Its blocks have different sizes than "
+                                 "the blocks of the first SDP.");
+    }
+}
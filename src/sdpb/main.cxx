@@ -11,12 +11,9 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
-Timers
-solve(const Block_Info &block_info, const SDP_Solver_Parameters &parameters);
+void run_job(const El::mpi::Comm &comm, SDP_Solver_Parameters &parameters);
 
-void write_timing(const boost::filesystem::path &checkpoint_out,
-                  const Block_Info &block_info, const Timers &timers,
-                  const bool &debug, El::Matrix<int32_t> &block_timings);
+void pack_jobs(const SDP_Solver_Parameters &parameters);
 
 int main(int argc, char **argv)
 {
@@ -31,6 +28,10 @@ int main(int argc, char **argv)
         }
 
       El::gmp::SetPrecision(parameters.precision);
+      if(parameters.algorithmic_block_size != 0)
+        {
+          El::SetBlocksize(parameters.algorithmic_block_size);
+        }
       if(parameters.verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
         {
           std::cout << "SDPB started at "
@@ -38,62 +39,14 @@ int main(int argc, char **argv)
                     << parameters << '\n';
         }
 
-      Block_Info block_info(parameters.sdp_directory, parameters.checkpoint_in,
-                            parameters.procs_per_node,
-                            parameters.proc_granularity, parameters.verbosity);
-      // Only generate a block_timings file if
-      // 1) We are running in parallel
-      // 2) We did not load a block_timings file
-      // 3) We are not going to load a checkpoint.
-      if(El::mpi::Size(El::mpi::COMM_WORLD) > 1
-         && block_info.block_timings_filename.empty()
-         && !exists(parameters.checkpoint_in / "checkpoint.0"))
+      if(parameters.packed_sdp_dirs.empty())
         {
-          if(parameters.verbosity >= Verbosity::regular
-             && El::mpi::Rank() == 0)
-            {
-              std::cout << "Performing a timing run\n";
-            }
-          SDP_Solver_Parameters timing_parameters(parameters);
-          timing_parameters.max_iterations = 2;
-          timing_parameters.no_final_checkpoint = true;
-          timing_parameters.checkpoint_interval
-            = std::numeric_limits<int64_t>::max();
-          timing_parameters.max_runtime = std::numeric_limits<int64_t>::max();
-          timing_parameters.duality_gap_threshold = 0;
-          timing_parameters.primal_error_threshold = 0;
-          timing_parameters.dual_error_threshold = 0;
-          if(timing_parameters.verbosity != Verbosity::debug)
-            {
-              timing_parameters.verbosity = Verbosity::none;
-            }
-          Timers timers(solve(block_info, timing_parameters));
-
-          El::Matrix<int32_t> block_timings(block_info.dimensions.size(), 1);
-          write_timing(timing_parameters.checkpoint_out, block_info, timers,
-                       timing_parameters.verbosity >= Verbosity::debug,
-                       block_timings);
-          El::mpi::Barrier(El::mpi::COMM_WORLD);
-          Block_Info new_info(
-            parameters.sdp_directory, block_timings, parameters.procs_per_node,
-            parameters.proc_granularity, parameters.verbosity);
-          std::swap(block_info, new_info);
-
-          parameters.max_runtime -= timers.front().second.elapsed_seconds();
+          run_job(El::mpi::COMM_WORLD, parameters);
         }
-      else if(!block_info.block_timings_filename.empty()
-              && block_info.block_timings_filename
-                   != (parameters.checkpoint_out / "block_timings"))
+      else
         {
-          if(El::mpi::Rank() == 0)
-            {
-              create_directories(parameters.checkpoint_out);
-              copy_file(block_info.block_timings_filename,
-                        parameters.checkpoint_out / "block_timings",
-                        boost::filesystem::copy_option::overwrite_if_exists);
-            }
+          pack_jobs(parameters);
         }
-      solve(block_info, parameters);
     }
   catch(std::exception &e)
     {
@@ -0,0 +1,39 @@
+#include "../sdp_solve.hxx"
+#include "../sdp_solve/Block_Cost_Model.hxx"
+
+#include <boost/filesystem.hpp>
+
+#include <cmath>
+#include <limits>
+
+size_t read_num_free_vars(const boost::filesystem::path &sdp_directory);
+
+void write_block_timings(const boost::filesystem::path &checkpoint_out,
+                         const El::mpi::Comm &comm,
+                         const El::Matrix<int32_t> &block_timings);
+
+// Fill block_timings with the milliseconds predicted by the block cost
+// model, in the same units as a timing run, and save them in
+// checkpointDir so that restarts use the same block layout.  Every
+// rank computes the same prediction, so there is no communication.
+
+void model_block_timings(const SDP_Solver_Parameters &parameters,
+                         const Block_Info &block_info,
+                         El::Matrix<int32_t> &block_timings)
+{
+  const Block_Cost_Model model(parameters.block_cost_model);
+  const size_t num_free_vars(read_num_free_vars(parameters.sdp_directory));
+  const double max_timing(std::numeric_limits<int32_t>::max());
+
+  block_timings.Resize(block_info.dimensions.size(), 1);
+  for(size_t block = 0; block < block_info.dimensions.size(); ++block)
+    {
+      const double milliseconds(model.milliseconds(
+        block_info.dimensions[block], block_info.degrees[block],
+        num_free_vars, parameters.precision));
+      block_timings(block, 0)
+        = static_cast<int32_t>(std::min(std::ceil(milliseconds), max_timing));
+    }
+  write_block_timings(parameters.checkpoint_out, block_info.solver_comm,
+                      block_timings);
+}
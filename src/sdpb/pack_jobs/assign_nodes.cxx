@@ -0,0 +1,41 @@
+#include <stdexcept>
+#include <vector>
+
+// Split num_nodes nodes into groups for jobs with the given costs,
+// sorted from most to least expensive.  With at least as many jobs as
+// nodes, every group is a single node, and the jobs are handed out as
+// groups finish.  Otherwise there is one group per job, and each
+// group gets at least one node.  The remaining nodes go, one at a
+// time, to the group with the largest cost per node, so that the
+// groups finish at about the same time.  This assumes each job scales
+// linearly with the number of nodes, which overestimates the speedup
+// of the large jobs.  Returns the number of nodes in each group.
+
+std::vector<size_t>
+assign_nodes(const std::vector<double> &sorted_costs, const size_t &num_nodes)
+{
+  if(num_nodes == 0)
+    {
+      throw std::runtime_error("No nodes to assign jobs to");
+    }
+  if(sorted_costs.size() >= num_nodes)
+    {
+      return std::vector<size_t>(num_nodes, 1);
+    }
+
+  std::vector<size_t> group_nodes(sorted_costs.size(), 1);
+  for(size_t node = sorted_costs.size(); node < num_nodes; ++node)
+    {
+      size_t busiest(0);
+      for(size_t group = 1; group < group_nodes.size(); ++group)
+        {
+          if(sorted_costs[group] * group_nodes[busiest]
+             > sorted_costs[busiest] * group_nodes[group])
+            {
+              busiest = group;
+            }
+        }
+      ++group_nodes[busiest];
+    }
+  return group_nodes;
+}
@@ -0,0 +1,142 @@
+#include "../../sdp_solve.hxx"
+#include "../../Timer.hxx"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+void run_job(const El::mpi::Comm &comm, SDP_Solver_Parameters &parameters);
+
+double predict_job_cost(const boost::filesystem::path &sdp_directory);
+
+std::vector<size_t>
+assign_nodes(const std::vector<double> &sorted_costs, const size_t &num_nodes);
+
+// Solve sdpDir and every packedSdpDirs directory, with independent
+// solves running at the same time on disjoint groups of nodes.
+//
+// The jobs are sorted by predicted cost, and the nodes are split into
+// groups (see assign_nodes).  Group g starts with the g'th most
+// expensive job.  After that, whenever a group finishes a job, it
+// takes the next most expensive job that nobody has started.  The
+// index of that job is a counter on rank 0 of COMM_WORLD, which each
+// group's root increments with a single atomic MPI_Fetch_and_op, so
+// that no process has to wait for any other group.
+//
+// Each job has its own Block_Info, grids, timing run and checkpoints,
+// exactly as if sdpb had been run on only that group's processes.
+
+void pack_jobs(const SDP_Solver_Parameters &parameters)
+{
+  std::vector<boost::filesystem::path> sdp_directories(
+    {parameters.sdp_directory});
+  sdp_directories.insert(sdp_directories.end(),
+                         parameters.packed_sdp_dirs.begin(),
+                         parameters.packed_sdp_dirs.end());
+  const int64_t num_jobs(sdp_directories.size());
+
+  const size_t rank(El::mpi::Rank(El::mpi::COMM_WORLD)),
+    num_procs(El::mpi::Size(El::mpi::COMM_WORLD)),
+    procs_per_node(parameters.procs_per_node);
+  if(num_procs % procs_per_node != 0)
+    {
+      throw std::runtime_error(
+        "Incompatible number of processes and processes per node.  "
+        "procsPerNode must evenly divide the total number of processes:\n\t"
+        "num_procs: "
+        + std::to_string(num_procs)
+        + "\n\tprocsPerNode: " + std::to_string(procs_per_node));
+    }
+
+  // Only the root reads the inputs, so that a large allocation does
+  // not swamp the file system.
+  std::vector<double> costs(num_jobs, 0);
+  if(rank == 0)
+    {
+      for(int64_t job = 0; job < num_jobs; ++job)
+        {
+          costs[job] = predict_job_cost(sdp_directories[job]);
+        }
+    }
+  El::mpi::Broadcast(costs.data(), costs.size(), 0, El::mpi::COMM_WORLD);
+
+  std::vector<size_t> jobs(num_jobs);
+  std::iota(jobs.begin(), jobs.end(), 0);
+  std::stable_sort(jobs.begin(), jobs.end(),
+                   [&](const size_t &a, const size_t &b) {
+                     return costs[a] > costs[b];
+                   });
+  std::vector<double> sorted_costs;
+  for(auto &job : jobs)
+    {
+      sorted_costs.push_back(costs[job]);
+    }
+  const std::vector<size_t> group_nodes(
+    assign_nodes(sorted_costs, num_procs / procs_per_node));
+
+  // Groups are contiguous ranges of whole nodes.
+  const size_t node(rank / procs_per_node);
+  size_t group(0), group_first_node(0);
+  while(node >= group_first_node + group_nodes[group])
+    {
+      group_first_node += group_nodes[group];
+      ++group;
+    }
+  El::mpi::Comm group_comm;
+  El::mpi::Split(El::mpi::COMM_WORLD, group, rank, group_comm);
+  const bool is_group_root(El::mpi::Rank(group_comm) == 0);
+
+  // The first group_nodes.size() jobs are handed out up front.
+  int64_t next_job(group_nodes.size());
+  MPI_Win next_job_window;
+  MPI_Win_create(&next_job, rank == 0 ? sizeof(next_job) : 0,
+                 sizeof(next_job), MPI_INFO_NULL, El::mpi::COMM_WORLD.comm,
+                 &next_job_window);
+
+  Timer timer;
+  const int64_t one(1);
+  int64_t job(group);
+  while(job < num_jobs)
+    {
+      const size_t index(jobs[job]);
+      const std::string index_string(std::to_string(index));
+      SDP_Solver_Parameters job_parameters(parameters);
+      job_parameters.packed_sdp_dirs.clear();
+      job_parameters.sdp_directory = sdp_directories[index];
+      job_parameters.out_directory = parameters.out_directory / index_string;
+      job_parameters.checkpoint_in = parameters.checkpoint_in / index_string;
+      job_parameters.checkpoint_out = parameters.checkpoint_out / index_string;
+      // maxRuntime is for the whole run, not for each job.
+      timer.stop();
+      job_parameters.max_runtime -= timer.elapsed_seconds();
+
+      if(is_group_root)
+        {
+          create_directories(job_parameters.out_directory);
+          if(parameters.verbosity >= Verbosity::regular)
+            {
+              std::cout << "Solving SDP " << index << " on "
+                        << El::mpi::Size(group_comm) << " processes: "
+                        << job_parameters.sdp_directory << '\n'
+                        << std::flush;
+            }
+        }
+      run_job(group_comm, job_parameters);
+
+      if(is_group_root)
+        {
+          MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, next_job_window);
+          MPI_Fetch_and_op(&one, &job, MPI_INT64_T, 0, 0, MPI_SUM,
+                           next_job_window);
+          MPI_Win_unlock(0, next_job_window);
+        }
+      // See the note in load_binary_checkpoint about Broadcast()
+      El::mpi::Broadcast(reinterpret_cast<El::byte *>(&job),
+                         sizeof(job) / sizeof(El::byte), 0, group_comm);
+    }
+
+  // MPI_Win_free waits for every group to finish.
+  MPI_Win_free(&next_job_window);
+  El::mpi::Free(group_comm);
+}
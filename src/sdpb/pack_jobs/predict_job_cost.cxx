@@ -0,0 +1,57 @@
+#include "../../sdp_solve/read_vector.hxx"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+size_t read_num_free_vars(const boost::filesystem::path &sdp_directory);
+
+// A rough estimate of the time for one iteration on the SDP in
+// sdp_directory, in arbitrary units.  Only the small blocks.* files
+// and the header of the objectives file are read.  With s_j the size
+// of block j of the Schur complement and N the number of free
+// variables, the leading costs are
+//
+//   Cholesky of S_j:            s_j^3/3
+//   L_j^{-1} B_j:               s_j^2 N
+//   Q += (L^{-1} B)^T L^{-1} B: s_j N^2
+//   Cholesky of Q:              N^3/3
+//
+// Only the ratios between SDPs matter, so the constants in front of
+// each term are left out.
+
+double predict_job_cost(const boost::filesystem::path &sdp_directory)
+{
+  const size_t N(read_num_free_vars(sdp_directory));
+  double cost(N * (N * (N / 3.0)));
+  size_t file_rank(0), file_num_procs(0);
+  do
+    {
+      const boost::filesystem::path block_path(
+        sdp_directory / ("blocks." + std::to_string(file_rank)));
+      boost::filesystem::ifstream block_stream(block_path);
+      if(!block_stream.good())
+        {
+          throw std::runtime_error("Could not open '" + block_path.string()
+                                   + "'");
+        }
+      block_stream >> file_num_procs;
+      if(!block_stream.good())
+        {
+          throw std::runtime_error("Corrupted file: " + block_path.string());
+        }
+      std::vector<size_t> block_indices, dimensions, degrees,
+        schur_block_sizes;
+      read_vector(block_stream, block_indices);
+      read_vector(block_stream, dimensions);
+      read_vector(block_stream, degrees);
+      read_vector(block_stream, schur_block_sizes);
+      for(auto &size : schur_block_sizes)
+        {
+          const double s(size);
+          cost += s * (s * (s / 3.0 + N) + N * double(N));
+        }
+      ++file_rank;
+    }
+  while(file_rank < file_num_procs);
+  return cost;
+}
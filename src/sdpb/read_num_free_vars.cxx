@@ -0,0 +1,20 @@
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+// The number of free variables N is the length of b, which is on the
+// second line of the objectives file.
+
+size_t read_num_free_vars(const boost::filesystem::path &sdp_directory)
+{
+  const boost::filesystem::path objectives_path(sdp_directory
+                                                / "objectives");
+  boost::filesystem::ifstream objectives_stream(objectives_path);
+  std::string objective_const;
+  size_t N;
+  objectives_stream >> objective_const >> N;
+  if(!objectives_stream.good())
+    {
+      throw std::runtime_error("Corrupted file: " + objectives_path.string());
+    }
+  return N;
+}
@@ -0,0 +1,34 @@
+#include "../sdp_solve.hxx"
+#include "../set_stream_precision.hxx"
+
+Timers run_and_save(const Block_Info &block_info,
+                    const SDP_Solver_Parameters &parameters, const SDP &sdp,
+                    const El::Grid &grid, SDP_Solver &solver,
+                    SDP_Solver_Terminate_Reason &reason)
+{
+  Timers timers(parameters.verbosity >= Verbosity::debug);
+  reason = solver.run(parameters, block_info, sdp, grid, timers);
+
+  if(parameters.verbosity >= Verbosity::regular
+     && El::mpi::Rank(block_info.solver_comm) == 0)
+    {
+      set_stream_precision(std::cout);
+      std::cout << "-----" << reason << "-----\n"
+                << '\n'
+                << "primalObjective = " << solver.primal_objective << '\n'
+                << "dualObjective   = " << solver.dual_objective << '\n'
+                << "dualityGap      = " << solver.duality_gap << '\n'
+                << "primalError     = " << solver.primal_error() << '\n'
+                << "dualError       = " << solver.dual_error << '\n'
+                << '\n';
+    }
+
+  if(!parameters.no_final_checkpoint)
+    {
+      solver.save_checkpoint(parameters, block_info);
+    }
+  solver.save_solution(reason, timers.front(), parameters.out_directory,
+                       parameters.write_solution, block_info,
+                       parameters.verbosity);
+  return timers;
+}
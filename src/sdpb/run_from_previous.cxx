@@ -0,0 +1,48 @@
+#include "../sdp_solve.hxx"
+
+Timers run_and_save(const Block_Info &block_info,
+                    const SDP_Solver_Parameters &parameters, const SDP &sdp,
+                    const El::Grid &grid, SDP_Solver &solver,
+                    SDP_Solver_Terminate_Reason &reason);
+
+void recenter_warm_start(const El::BigFloat &target_mu,
+                         const Block_Info &block_info,
+                         Block_Diagonal_Matrix &X, Block_Diagonal_Matrix &Y);
+
+// Solve one SDP in a sequence of related SDPs that share a solver.
+// The output and checkpoints go in outDir/index and
+// checkpointDir/index.  The solve resumes from its own checkpoint if
+// there is one.  Otherwise, unless this is the first solve, it starts
+// from the solution of the previous solve, shifted toward the
+// interior as for warmStartDir.
+Timers run_from_previous(const Block_Info &block_info,
+                         const SDP_Solver_Parameters &parameters,
+                         const size_t &index, const bool &is_first,
+                         const SDP &sdp, const El::Grid &grid,
+                         SDP_Solver &solver,
+                         SDP_Solver_Terminate_Reason &reason)
+{
+  SDP_Solver_Parameters index_parameters(parameters);
+  index_parameters.out_directory
+    = parameters.out_directory / std::to_string(index);
+  index_parameters.checkpoint_out
+    = parameters.checkpoint_out / std::to_string(index);
+  if(El::mpi::Rank(block_info.solver_comm) == 0)
+    {
+      create_directories(index_parameters.out_directory);
+    }
+
+  // Checkpoints in checkpointDir/index belong to this solve, so the
+  // generations start over.
+  solver.current_generation = 0;
+  solver.backup_generation = boost::none;
+  if(!solver.load_checkpoint(index_parameters.checkpoint_out, block_info,
+                             parameters.verbosity, false)
+     && !is_first)
+    {
+      recenter_warm_start(parameters.warm_start_mu, block_info, solver.X,
+                          solver.Y);
+    }
+  return run_and_save(block_info, index_parameters, sdp, grid, solver,
+                      reason);
+}
@@ -0,0 +1,109 @@
+#include "../sdp_solve.hxx"
+
+#include <El.hpp>
+
+Timers
+solve(const Block_Info &block_info, const SDP_Solver_Parameters &parameters);
+
+Timers
+bisect(const Block_Info &block_info, const SDP_Solver_Parameters &parameters);
+
+void write_timing(const boost::filesystem::path &checkpoint_out,
+                  const Block_Info &block_info, const Timers &timers,
+                  const bool &debug, El::Matrix<int32_t> &block_timings);
+
+void model_block_timings(const SDP_Solver_Parameters &parameters,
+                         const Block_Info &block_info,
+                         El::Matrix<int32_t> &block_timings);
+
+void calibrate_block_timings(const SDP_Solver_Parameters &parameters,
+                             const Block_Info &block_info,
+                             El::Matrix<int32_t> &block_timings);
+
+// Load balance, and then solve or bisect, with the processes in
+// comm.  If there are no block timings yet, first get them from
+// kernel benchmarks, the block cost model, or a short timing run.
+
+void run_job(const El::mpi::Comm &comm, SDP_Solver_Parameters &parameters)
+{
+  Block_Info block_info(comm, parameters.sdp_directory,
+                        parameters.checkpoint_in, parameters.procs_per_node,
+                        parameters.proc_granularity, parameters.verbosity);
+  // Only generate a block_timings file if
+  // 1) We are running in parallel
+  // 2) We did not load a block_timings file
+  // 3) We are not going to load a checkpoint.
+  if(El::mpi::Size(comm) > 1 && block_info.block_timings_filename.empty()
+     && !exists(parameters.checkpoint_in / "checkpoint.0"))
+    {
+      El::Matrix<int32_t> block_timings(block_info.dimensions.size(), 1);
+      if(parameters.calibrate_block_costs)
+        {
+          calibrate_block_timings(parameters, block_info, block_timings);
+        }
+      else if(!parameters.block_cost_model.empty())
+        {
+          if(parameters.verbosity >= Verbosity::regular
+             && El::mpi::Rank(comm) == 0)
+            {
+              std::cout << "Predicting block timings with "
+                        << parameters.block_cost_model << '\n';
+            }
+          model_block_timings(parameters, block_info, block_timings);
+        }
+      else
+        {
+          if(parameters.verbosity >= Verbosity::regular
+             && El::mpi::Rank(comm) == 0)
+            {
+              std::cout << "Performing a timing run\n";
+            }
+          SDP_Solver_Parameters timing_parameters(parameters);
+          timing_parameters.max_iterations = 2;
+          timing_parameters.no_final_checkpoint = true;
+          timing_parameters.checkpoint_interval
+            = std::numeric_limits<int64_t>::max();
+          timing_parameters.max_runtime = std::numeric_limits<int64_t>::max();
+          timing_parameters.duality_gap_threshold = 0;
+          timing_parameters.primal_error_threshold = 0;
+          timing_parameters.dual_error_threshold = 0;
+          timing_parameters.batch_objectives.clear();
+          timing_parameters.bisection_points.clear();
+          if(timing_parameters.verbosity != Verbosity::debug)
+            {
+              timing_parameters.verbosity = Verbosity::none;
+            }
+          Timers timers(solve(block_info, timing_parameters));
+
+          write_timing(timing_parameters.checkpoint_out, block_info, timers,
+                       timing_parameters.verbosity >= Verbosity::debug,
+                       block_timings);
+          parameters.max_runtime -= timers.front().second.elapsed_seconds();
+        }
+      El::mpi::Barrier(comm);
+      Block_Info new_info(comm, parameters.sdp_directory, block_timings,
+                          parameters.procs_per_node,
+                          parameters.proc_granularity, parameters.verbosity);
+      std::swap(block_info, new_info);
+    }
+  else if(!block_info.block_timings_filename.empty()
+          && block_info.block_timings_filename
+               != (parameters.checkpoint_out / "block_timings"))
+    {
+      if(El::mpi::Rank(comm) == 0)
+        {
+          create_directories(parameters.checkpoint_out);
+          copy_file(block_info.block_timings_filename,
+                    parameters.checkpoint_out / "block_timings",
+                    boost::filesystem::copy_option::overwrite_if_exists);
+        }
+    }
+  if(parameters.bisection_points.empty())
+    {
+      solve(block_info, parameters);
+    }
+  else
+    {
+      bisect(block_info, parameters);
+    }
+}
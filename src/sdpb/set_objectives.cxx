@@ -0,0 +1,25 @@
+#include "../sdp_solve.hxx"
+
+void read_objectives(const boost::filesystem::path &objectives_path,
+                     const El::Grid &grid, El::BigFloat &objective_const,
+                     El::DistMatrix<El::BigFloat> &dual_objective_b);
+
+// Replace the objective constant and b of sdp with the ones in
+// objectives_path, which has the same format as sdpDir/objectives.
+// Everything else in sdp stays the same, so b must keep its length.
+void set_objectives(const boost::filesystem::path &objectives_path,
+                    const El::Grid &grid, SDP &sdp)
+{
+  El::DistMatrix<El::BigFloat> dual_objective_b(grid);
+  read_objectives(objectives_path, grid, sdp.objective_const,
+                  dual_objective_b);
+  if(dual_objective_b.Height() != sdp.dual_objective_b.Height())
+    {
+      throw std::runtime_error(
+        "Incompatible objectives in " + objectives_path.string()
+        + ".  Expected b to have length "
+        + std::to_string(sdp.dual_objective_b.Height()) + ", but found "
+        + std::to_string(dual_objective_b.Height()));
+    }
+  El::Copy(dual_objective_b, sdp.dual_objective_b);
+}
@@ -6,12 +6,29 @@
 //=======================================================================
 
 #include "../sdp_solve.hxx"
-#include "../set_stream_precision.hxx"
 
 #include <El.hpp>
-#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem.hpp>
 
+Timers run_and_save(const Block_Info &block_info,
+                    const SDP_Solver_Parameters &parameters, const SDP &sdp,
+                    const El::Grid &grid, SDP_Solver &solver,
+                    SDP_Solver_Terminate_Reason &reason);
+
+Timers run_from_previous(const Block_Info &block_info,
+                         const SDP_Solver_Parameters &parameters,
+                         const size_t &index, const bool &is_first,
+                         const SDP &sdp, const El::Grid &grid,
+                         SDP_Solver &solver,
+                         SDP_Solver_Terminate_Reason &reason);
+
+void set_objectives(const boost::filesystem::path &objectives_path,
+                    const El::Grid &grid, SDP &sdp);
+
+// With batchObjectives, the blocks, free variable matrix and grids
+// are loaded once, and only the objectives change between solves.
+// Each solve resumes from its own checkpoint if there is one, and
+// otherwise starts from the previous solution.
 Timers
 solve(const Block_Info &block_info, const SDP_Solver_Parameters &parameters)
 {
@@ -21,30 +38,26 @@ solve(const Block_Info &block_info, const SDP_Solver_Parameters &parameters)
   SDP_Solver solver(parameters, block_info, grid,
                     sdp.dual_objective_b.Height());
 
-  Timers timers(parameters.verbosity >= Verbosity::debug);
-  SDP_Solver_Terminate_Reason reason
-    = solver.run(parameters, block_info, sdp, grid, timers);
-
-  if(parameters.verbosity >= Verbosity::regular && El::mpi::Rank() == 0)
+  SDP_Solver_Terminate_Reason reason;
+  if(parameters.batch_objectives.empty())
     {
-      set_stream_precision(std::cout);
-      std::cout << "-----" << reason << "-----\n"
-                << '\n'
-                << "primalObjective = " << solver.primal_objective << '\n'
-                << "dualObjective   = " << solver.dual_objective << '\n'
-                << "dualityGap      = " << solver.duality_gap << '\n'
-                << "primalError     = " << solver.primal_error() << '\n'
-                << "dualError       = " << solver.dual_error << '\n'
-                << '\n';
+      return run_and_save(block_info, parameters, sdp, grid, solver, reason);
     }
 
-  if(!parameters.no_final_checkpoint)
+  Timers timers(parameters.verbosity >= Verbosity::debug);
+  for(size_t index = 0; index < parameters.batch_objectives.size(); ++index)
     {
-      solver.save_checkpoint(parameters);
+      const boost::filesystem::path &objectives_path(
+        parameters.batch_objectives[index]);
+      if(parameters.verbosity >= Verbosity::regular
+         && El::mpi::Rank(block_info.solver_comm) == 0)
+        {
+          std::cout << "Solving with objectives: " << objectives_path
+                    << '\n';
+        }
+      set_objectives(objectives_path, grid, sdp);
+      timers = run_from_previous(block_info, parameters, index, index == 0,
+                                 sdp, grid, solver, reason);
     }
-  solver.save_solution(reason, timers.front(), parameters.out_directory,
-                       parameters.write_solution,
-                       block_info.block_indices,
-                       parameters.verbosity);
   return timers;
 }
@@ -0,0 +1,27 @@
+#include <El.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+// block_timings must be the same on every rank of comm.
+
+void write_block_timings(const boost::filesystem::path &checkpoint_out,
+                         const El::mpi::Comm &comm,
+                         const El::Matrix<int32_t> &block_timings)
+{
+  if(El::mpi::Rank(comm) == 0)
+    {
+      boost::filesystem::create_directories(checkpoint_out);
+      boost::filesystem::path block_timings_path(checkpoint_out
+                                                 / "block_timings");
+      boost::filesystem::ofstream block_timings_file(block_timings_path);
+      for(int64_t row = 0; row < block_timings.Height(); ++row)
+        {
+          block_timings_file << block_timings(row, 0) << "\n";
+        }
+      if(!block_timings_file.good())
+        {
+          throw std::runtime_error("Error when writing to: "
+                                   + block_timings_path.string());
+        }
+    }
+}
@@ -1,7 +1,27 @@
 #include "../sdp_solve.hxx"
 
 #include <boost/filesystem.hpp>
-#include <boost/filesystem/fstream.hpp>
+
+void write_block_timings(const boost::filesystem::path &checkpoint_out,
+                         const El::mpi::Comm &comm,
+                         const El::Matrix<int32_t> &block_timings);
+
+namespace
+{
+  bool has_timer(const Timers &timers, const std::string &name)
+  {
+    return std::find_if(timers.begin(), timers.end(),
+                        [&name](const std::pair<std::string, Timer> &timer) {
+                          return timer.first == name;
+                        })
+           != timers.end();
+  }
+}
+
+// The cost of a block is the time to factor it and multiply it into
+// Q.  Blocks that are solved iteratively are never factored, so their
+// cost is the time to build the preconditioner and run conjugate
+// gradients instead.
 
 void write_timing(const boost::filesystem::path &checkpoint_out,
                   const Block_Info &block_info, const Timers &timers,
@@ -9,41 +29,33 @@ void write_timing(const boost::filesystem::path &checkpoint_out,
 {
   if(debug)
     {
-      timers.write_profile(checkpoint_out.string() + ".profiling."
-                           + std::to_string(El::mpi::Rank()));
+      timers.write_profile(
+        checkpoint_out.string() + ".profiling."
+        + std::to_string(El::mpi::Rank(block_info.solver_comm)));
     }
 
+  const std::string prefix("run.step.initializeSchurComplementSolver.");
   El::Zero(block_timings);
   for(auto &index : block_info.block_indices)
     {
-      block_timings(index, 0) = timers.elapsed_milliseconds(
-                                  "run.step.initializeSchurComplementSolver."
-                                  "Q.syrk_"
-                                  + std::to_string(index))
-                                + timers.elapsed_milliseconds(
-                                    "run.step.initializeSchurComplementSolver."
-                                    "Q.solve_"
-                                    + std::to_string(index))
-                                + timers.elapsed_milliseconds(
-                                    "run.step.initializeSchurComplementSolver."
-                                    "Q.cholesky_"
-                                    + std::to_string(index));
-    }
-  El::AllReduce(block_timings, El::mpi::COMM_WORLD);
-  if(El::mpi::Rank() == 0)
-    {
-      boost::filesystem::create_directories(checkpoint_out);
-      boost::filesystem::path block_timings_path(checkpoint_out
-                                                 / "block_timings");
-      boost::filesystem::ofstream block_timings_file(block_timings_path);
-      for(int64_t row = 0; row < block_timings.Height(); ++row)
+      const std::string suffix(std::to_string(index));
+      block_timings(index, 0)
+        = timers.elapsed_milliseconds(prefix + "Q.syrk_" + suffix);
+      if(has_timer(timers, prefix + "preconditioner_" + suffix))
         {
-          block_timings_file << block_timings(row, 0) << "\n";
+          block_timings(index, 0)
+            += timers.elapsed_milliseconds(prefix + "preconditioner_"
+                                           + suffix)
+               + timers.elapsed_milliseconds(prefix + "Q.iterative_solve_"
+                                             + suffix);
         }
-      if(!block_timings_file.good())
+      else
         {
-          throw std::runtime_error("Error when writing to: "
-                                   + block_timings_path.string());
+          block_timings(index, 0)
+            += timers.elapsed_milliseconds(prefix + "Q.solve_" + suffix)
+               + timers.elapsed_milliseconds(prefix + "Q.cholesky_" + suffix);
         }
     }
+  El::AllReduce(block_timings, block_info.solver_comm);
+  write_block_timings(checkpoint_out, block_info.solver_comm, block_timings);
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../sdp_solve.hxx"
+
+// An SDP kept in memory by sdpb_server, together with the load
+// balancing and grid it was distributed with.  write_time is the
+// latest modification time of any file in sdp_directory when it was
+// read, so that an SDP that has been rewritten is read again.
+
+struct Cached_SDP
+{
+  boost::filesystem::path sdp_directory;
+  int64_t write_time;
+  Block_Info block_info;
+  El::Grid grid;
+  SDP sdp;
+
+  Cached_SDP(const SDP_Solver_Parameters &parameters,
+             const int64_t &write_time)
+      : sdp_directory(parameters.sdp_directory), write_time(write_time),
+        block_info(El::mpi::COMM_WORLD, parameters.sdp_directory,
+                   parameters.checkpoint_in, parameters.procs_per_node,
+                   parameters.proc_granularity, parameters.verbosity),
+        grid(block_info.mpi_comm.value),
+        sdp(parameters.sdp_directory, block_info, grid)
+  {}
+};
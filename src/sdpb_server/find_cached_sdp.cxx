@@ -0,0 +1,112 @@
+#include "Cached_SDP.hxx"
+
+#include <list>
+
+namespace
+{
+  // The canonical path of sdp_directory, and the latest modification
+  // time of it or any file in it.  Only the root reads the file system,
+  // so that every process agrees.  The root broadcasts whether it
+  // succeeded before anything else, so a missing or unreadable
+  // directory fails the job on every process instead of leaving the
+  // others waiting in a Broadcast.
+  void directory_write_time(const boost::filesystem::path &sdp_directory,
+                            boost::filesystem::path &canonical_directory,
+                            int64_t &write_time)
+  {
+    std::string canonical, error;
+    write_time = 0;
+    if(El::mpi::Rank() == 0)
+      {
+        try
+          {
+            canonical
+              = boost::filesystem::canonical(sdp_directory).string();
+            write_time = boost::filesystem::last_write_time(canonical);
+            for(auto &entry :
+                boost::filesystem::directory_iterator(canonical))
+              {
+                write_time = std::max(
+                  write_time,
+                  int64_t(boost::filesystem::last_write_time(entry.path())));
+              }
+          }
+        catch(std::exception &e)
+          {
+            error = e.what();
+          }
+      }
+    int succeeded(error.empty());
+    El::mpi::Broadcast(succeeded, 0, El::mpi::COMM_WORLD);
+    if(succeeded == 0)
+      {
+        throw std::runtime_error(
+          "Unable to read sdpDir '" + sdp_directory.string() + "'"
+          + (error.empty() ? std::string(".") : ": " + error));
+      }
+
+    // See the note in load_binary_checkpoint about Broadcast()
+    El::mpi::Broadcast(reinterpret_cast<El::byte *>(&write_time),
+                       sizeof(write_time) / sizeof(El::byte), 0,
+                       El::mpi::COMM_WORLD);
+    int64_t size(canonical.size());
+    El::mpi::Broadcast(reinterpret_cast<El::byte *>(&size),
+                       sizeof(size) / sizeof(El::byte), 0,
+                       El::mpi::COMM_WORLD);
+    canonical.resize(size);
+    El::mpi::Broadcast(reinterpret_cast<El::byte *>(&canonical[0]), size, 0,
+                       El::mpi::COMM_WORLD);
+    canonical_directory = canonical;
+  }
+}
+
+// Return the SDP in parameters.sdp_directory, reading it only if it
+// is not already in the cache, or has changed since it was read.  The
+// cache is ordered from most to least recently used, and holds at most
+// cache_size SDPs.  Every process sees the same sequence of jobs, so
+// every process adds and evicts the same entries.  Errors finding the
+// SDP are thrown on every process, before anything collective has
+// started.
+
+Cached_SDP &find_cached_sdp(const SDP_Solver_Parameters &parameters,
+                            const size_t &cache_size,
+                            std::list<Cached_SDP> &cache)
+{
+  boost::filesystem::path sdp_directory;
+  int64_t write_time;
+  directory_write_time(parameters.sdp_directory, sdp_directory, write_time);
+
+  for(auto cached(cache.begin()); cached != cache.end(); ++cached)
+    {
+      if(cached->sdp_directory == sdp_directory)
+        {
+          if(cached->write_time == write_time)
+            {
+              cache.splice(cache.begin(), cache, cached);
+              return cache.front();
+            }
+          cache.erase(cached);
+          break;
+        }
+    }
+
+  // Free the old SDPs before reading the new one.
+  while(!cache.empty() && cache.size() >= cache_size)
+    {
+      cache.pop_back();
+    }
+  SDP_Solver_Parameters canonical_parameters(parameters);
+  canonical_parameters.sdp_directory = sdp_directory;
+  // Reading an SDP is collective, so a failure part way through can
+  // not be recovered from.  As in sdpb, it ends the run.
+  try
+    {
+      cache.emplace_front(canonical_parameters, write_time);
+    }
+  catch(std::exception &e)
+    {
+      El::ReportException(e);
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+  return cache.front();
+}
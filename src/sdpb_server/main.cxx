@@ -0,0 +1,132 @@
+#include "Cached_SDP.hxx"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <list>
+
+namespace po = boost::program_options;
+
+boost::filesystem::path next_job(const boost::filesystem::path &spool_dir,
+                                 const int64_t &poll_interval);
+
+void solve_job(const boost::filesystem::path &job_path,
+               const std::vector<std::string> &server_arguments,
+               const size_t &cache_size, std::list<Cached_SDP> &cache);
+
+// A long running sdpb that takes jobs from a spool directory.  MPI,
+// Elemental and the precision are set up once, and the most recently
+// used SDPs stay in memory, so repeated solves of small SDPs do not
+// pay for startup and reading the input every time.
+
+int main(int argc, char **argv)
+{
+  El::Environment env(argc, argv);
+
+  try
+    {
+      boost::filesystem::path spool_dir;
+      size_t precision, procs_per_node, proc_granularity, cache_size;
+      int64_t poll_interval;
+
+      po::options_description options("Basic options");
+      options.add_options()("help,h", "Show this helpful message.");
+      options.add_options()(
+        "spoolDir", po::value<boost::filesystem::path>(&spool_dir)->required(),
+        "Directory to watch for jobs.  Each job is a file NAME.job, in the "
+        "same key=value format as sdpb's paramFile.  While it runs, it is "
+        "renamed to NAME.running, and when it is finished to NAME.done or "
+        "NAME.failed.  Create a file named 'stop' to shut down the server.");
+      options.add_options()(
+        "precision", po::value<size_t>(&precision)->required(),
+        "The precision, in the number of bits, for every job.");
+      options.add_options()(
+        "procsPerNode", po::value<size_t>(&procs_per_node)->required(),
+        "The number of processes that can run on a node.");
+      options.add_options()(
+        "procGranularity",
+        po::value<size_t>(&proc_granularity)->default_value(1),
+        "The minimum number of cores in a group, used during load "
+        "balancing.");
+      options.add_options()(
+        "cacheSize", po::value<size_t>(&cache_size)->default_value(4),
+        "The number of SDPs to keep in memory.");
+      options.add_options()(
+        "pollInterval", po::value<int64_t>(&poll_interval)->default_value(100),
+        "Milliseconds to wait before looking for new jobs again.");
+
+      po::variables_map variables_map;
+      po::store(po::parse_command_line(argc, argv, options), variables_map);
+
+      if(variables_map.count("help") != 0)
+        {
+          if(El::mpi::Rank() == 0)
+            {
+              std::cout << options << '\n';
+            }
+          return 0;
+        }
+      po::notify(variables_map);
+      if(!boost::filesystem::is_directory(spool_dir))
+        {
+          throw std::runtime_error("spool directory '" + spool_dir.string()
+                                   + "' is not a directory");
+        }
+      if(cache_size == 0)
+        {
+          throw std::runtime_error("cacheSize must be at least 1");
+        }
+
+      El::gmp::SetPrecision(precision);
+      const std::vector<std::string> server_arguments(
+        {"sdpb_server", "--precision=" + std::to_string(precision),
+         "--procsPerNode=" + std::to_string(procs_per_node),
+         "--procGranularity=" + std::to_string(proc_granularity)});
+
+      const int rank(El::mpi::Rank());
+      std::list<Cached_SDP> cache;
+      for(boost::filesystem::path job(next_job(spool_dir, poll_interval));
+          !job.empty(); job = next_job(spool_dir, poll_interval))
+        {
+          std::string error;
+          try
+            {
+              solve_job(job, server_arguments, cache_size, cache);
+            }
+          catch(std::exception &e)
+            {
+              error = e.what();
+              std::cerr << "Rank " << rank << ": " << job << ": " << error
+                        << '\n'
+                        << std::flush;
+            }
+          // solve_job only throws before anything collective, so every
+          // process gets here.
+          const int succeeded(El::mpi::AllReduce(
+            static_cast<int>(error.empty()), El::mpi::MIN,
+            El::mpi::COMM_WORLD));
+          if(rank == 0)
+            {
+              boost::filesystem::path finished(job);
+              finished.replace_extension(succeeded != 0 ? ".done"
+                                                        : ".failed");
+              boost::filesystem::rename(job, finished);
+              if(!error.empty())
+                {
+                  boost::filesystem::ofstream finished_stream(
+                    finished, std::ios::app);
+                  finished_stream << "\n# Error: " << error << '\n';
+                }
+            }
+        }
+    }
+  catch(std::exception &e)
+    {
+      El::ReportException(e);
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+  catch(...)
+    {
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+}
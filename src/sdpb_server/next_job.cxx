@@ -0,0 +1,62 @@
+#include <El.hpp>
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+// Wait for the next job in spool_dir, and claim it by renaming
+// NAME.job to NAME.running.  Jobs are taken in order of their names.
+// A file named 'stop' shuts down the server once the current jobs are
+// done, and is returned as an empty path.  Only the root looks at
+// spool_dir, so every process gets the same answer.
+
+boost::filesystem::path next_job(const boost::filesystem::path &spool_dir,
+                                 const int64_t &poll_interval)
+{
+  std::string job;
+  if(El::mpi::Rank() == 0)
+    {
+      const boost::filesystem::path stop_path(spool_dir / "stop");
+      while(job.empty())
+        {
+          std::vector<boost::filesystem::path> jobs;
+          for(auto &entry : boost::filesystem::directory_iterator(spool_dir))
+            {
+              if(entry.path().extension() == ".job"
+                 && boost::filesystem::is_regular_file(entry.path()))
+                {
+                  jobs.push_back(entry.path());
+                }
+            }
+          if(!jobs.empty())
+            {
+              const boost::filesystem::path first(
+                *std::min_element(jobs.begin(), jobs.end()));
+              boost::filesystem::path running(first);
+              running.replace_extension(".running");
+              boost::filesystem::rename(first, running);
+              job = running.string();
+            }
+          else if(exists(stop_path))
+            {
+              boost::filesystem::remove(stop_path);
+              break;
+            }
+          else
+            {
+              std::this_thread::sleep_for(
+                std::chrono::milliseconds(poll_interval));
+            }
+        }
+    }
+
+  int64_t size(job.size());
+  // See the note in load_binary_checkpoint about Broadcast()
+  El::mpi::Broadcast(reinterpret_cast<El::byte *>(&size),
+                     sizeof(size) / sizeof(El::byte), 0, El::mpi::COMM_WORLD);
+  job.resize(size);
+  El::mpi::Broadcast(reinterpret_cast<El::byte *>(&job[0]), size, 0,
+                     El::mpi::COMM_WORLD);
+  return job;
+}
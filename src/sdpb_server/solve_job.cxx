@@ -0,0 +1,67 @@
+#include "Cached_SDP.hxx"
+
+#include <list>
+
+Timers run_and_save(const Block_Info &block_info,
+                    const SDP_Solver_Parameters &parameters, const SDP &sdp,
+                    const El::Grid &grid, SDP_Solver &solver,
+                    SDP_Solver_Terminate_Reason &reason);
+
+Cached_SDP &find_cached_sdp(const SDP_Solver_Parameters &parameters,
+                            const size_t &cache_size,
+                            std::list<Cached_SDP> &cache);
+
+// Solve the job in job_path, a parameter file in the same key=value
+// format as sdpb's paramFile.  server_arguments come after the job's
+// parameters, so the server's precision and process layout override
+// anything in the job.  The output goes to the job's outDir, exactly
+// as if sdpb had been run with that paramFile.
+//
+// Errors in the job itself, such as bad parameters or a missing
+// sdpDir, are thrown on every process before anything collective, so
+// the server can mark the job as failed and go on.  Anything that goes
+// wrong while reading the SDP or solving aborts the server.
+
+void solve_job(const boost::filesystem::path &job_path,
+               const std::vector<std::string> &server_arguments,
+               const size_t &cache_size, std::list<Cached_SDP> &cache)
+{
+  std::vector<std::string> arguments(server_arguments);
+  arguments.push_back("--paramFile=" + job_path.string());
+  std::vector<char *> argv;
+  for(auto &argument : arguments)
+    {
+      argv.push_back(&argument[0]);
+    }
+  SDP_Solver_Parameters parameters(argv.size(), argv.data());
+  if(!parameters.is_valid())
+    {
+      throw std::runtime_error("No sdpDir in " + job_path.string());
+    }
+  if(!parameters.batch_objectives.empty()
+     || !parameters.bisection_points.empty()
+     || !parameters.packed_sdp_dirs.empty())
+    {
+      throw std::runtime_error(
+        "sdpb_server jobs can not use batchObjectives, bisectionPoints, or "
+        "packedSdpDirs.");
+    }
+
+  Cached_SDP &cached(find_cached_sdp(parameters, cache_size, cache));
+
+  // The solve is collective, so a failure part way through can not be
+  // recovered from.  As in sdpb, it ends the run.
+  try
+    {
+      SDP_Solver solver(parameters, cached.block_info, cached.grid,
+                        cached.sdp.dual_objective_b.Height());
+      SDP_Solver_Terminate_Reason reason;
+      run_and_save(cached.block_info, parameters, cached.sdp, cached.grid,
+                   solver, reason);
+    }
+  catch(std::exception &e)
+    {
+      El::ReportException(e);
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "sdp_read.hxx"
+#include "sdp_solve.hxx"
+
+// The result of solving a polynomial matrix program with solve_pmp().
+// y holds every component of the solution, including the component
+// that is fixed by the normalization condition n.y = 1.  It is the
+// same on every rank.
+struct PMP_Solution
+{
+  SDP_Solver_Terminate_Reason reason;
+  El::BigFloat primal_objective, dual_objective, duality_gap, primal_error,
+    dual_error;
+  std::vector<El::BigFloat> y;
+};
+
+// Solve a polynomial matrix program in memory, without writing the
+// SDP to disk.  This does the same conversion as sdp2input, and then
+// the same solve as sdpb.  Every rank in comm must pass the same
+// arguments.  The caller sets the precision of El::BigFloat and
+// Boost_Float beforehand, as in sdp2input.
+//
+// parameters.sdp_directory and parameters.out_directory are not used.
+// Checkpoints are still loaded from and saved to checkpoint_in and
+// checkpoint_out, so set checkpointInterval high to avoid writing
+// them.
+PMP_Solution
+solve_pmp(const El::mpi::Comm &comm,
+          const std::vector<El::BigFloat> &objectives,
+          const std::vector<El::BigFloat> &normalization,
+          const std::vector<Positive_Matrix_With_Prefactor> &matrices,
+          const SDP_Solver_Parameters &parameters, Timers &timers);
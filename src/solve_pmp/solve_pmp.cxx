@@ -0,0 +1,81 @@
+#include "../solve_pmp.hxx"
+
+// Each rank only converts the blocks that Block_Info assigns to it.
+// The ranks that share a block each convert it, which is redundant,
+// but avoids communicating the converted blocks.
+
+PMP_Solution
+solve_pmp(const El::mpi::Comm &comm,
+          const std::vector<El::BigFloat> &objectives,
+          const std::vector<El::BigFloat> &normalization,
+          const std::vector<Positive_Matrix_With_Prefactor> &matrices,
+          const SDP_Solver_Parameters &parameters, Timers &timers)
+{
+  if(matrices.empty())
+    {
+      throw std::runtime_error("No positive matrices to solve");
+    }
+
+  auto &objectives_timer(timers.add_and_start("solve_pmp.objectives"));
+  size_t max_index;
+  El::BigFloat objective_const;
+  std::vector<El::BigFloat> dual_objective_b;
+  convert_objectives(objectives, normalization, max_index, objective_const,
+                     dual_objective_b);
+  objectives_timer.stop();
+
+  std::vector<size_t> dimensions, degrees;
+  dimensions.reserve(matrices.size());
+  degrees.reserve(matrices.size());
+  for(auto &matrix : matrices)
+    {
+      dimensions.push_back(matrix.polynomials.size());
+      degrees.push_back(max_degree(matrix));
+    }
+  Block_Info block_info(comm, dimensions, degrees, parameters.procs_per_node,
+                        parameters.proc_granularity, parameters.verbosity);
+  El::Grid grid(block_info.mpi_comm.value);
+
+  auto &matrices_timer(timers.add_and_start("solve_pmp.matrices"));
+  std::vector<Dual_Constraint_Group> dual_constraint_groups;
+  dual_constraint_groups.reserve(block_info.block_indices.size());
+  for(auto &block_index : block_info.block_indices)
+    {
+      dual_constraint_groups.push_back(to_dual_constraint_group(
+        matrices.at(block_index), normalization, max_index,
+        "solve_pmp.matrices", block_index, timers));
+    }
+  matrices_timer.stop();
+
+  auto &sdp_timer(timers.add_and_start("solve_pmp.sdp"));
+  SDP sdp(objective_const, dual_objective_b, dual_constraint_groups,
+          block_info, grid);
+  dual_constraint_groups.clear();
+  sdp_timer.stop();
+
+  SDP_Solver solver(parameters, block_info, grid,
+                    sdp.dual_objective_b.Height());
+
+  PMP_Solution result;
+  result.reason = solver.run(parameters, block_info, sdp, grid, timers);
+  result.primal_objective = solver.primal_objective;
+  result.dual_objective = solver.dual_objective;
+  result.duality_gap = solver.duality_gap;
+  result.primal_error = solver.primal_error();
+  result.dual_error = solver.dual_error;
+
+  // y is duplicated among the blocks.  The component at max_index is
+  // fixed by the normalization condition n.y = 1.
+  const El::DistMatrix<El::BigFloat, El::STAR, El::STAR> y_star(
+    solver.y.blocks.at(0));
+  result.y.resize(normalization.size());
+  result.y.at(max_index) = 1;
+  for(int64_t row = 0; row < y_star.Height(); ++row)
+    {
+      const size_t index(row + (size_t(row) < max_index ? 0 : 1));
+      result.y.at(index) = y_star.GetLocal(row, 0);
+      result.y.at(max_index) -= result.y.at(index) * normalization.at(index);
+    }
+  result.y.at(max_index) /= normalization.at(max_index);
+  return result;
+}
@@ -0,0 +1,119 @@
+#include "../solve_pmp.hxx"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <string>
+
+void read_input(const boost::filesystem::path &input_file,
+                std::vector<El::BigFloat> &objectives,
+                std::vector<El::BigFloat> &normalization,
+                std::vector<Positive_Matrix_With_Prefactor> &matrices);
+
+// Solve an sdp2input input file with solve_pmp(), and compare the
+// objectives with the out.txt written by sdpb for the same file after
+// sdp2input.  Usage:
+//
+//   solve_pmp_test INPUT OUT_TXT [sdpb options]
+//
+// The sdpb options should be the ones used for the sdpb run.  The
+// objectives must agree to within dualityGapThreshold.  Returns 0 if
+// they agree and 1 otherwise.
+
+namespace
+{
+  El::BigFloat read_out_value(const boost::filesystem::path &out_path,
+                              const std::string &key)
+  {
+    boost::filesystem::ifstream out_stream(out_path);
+    if(!out_stream.good())
+      {
+        throw std::runtime_error("Could not open '" + out_path.string()
+                                 + "'");
+      }
+    std::string line;
+    while(std::getline(out_stream, line))
+      {
+        const size_t equals(line.find('='));
+        if(equals != std::string::npos
+           && line.compare(0, key.size(), key) == 0
+           && line.find_first_not_of(' ', key.size()) == equals)
+          {
+            const size_t begin(line.find_first_not_of(' ', equals + 1)),
+              end(line.find(';', begin));
+            return El::BigFloat(line.substr(begin, end - begin), 10);
+          }
+      }
+    throw std::runtime_error("Could not find " + key + " in '"
+                             + out_path.string() + "'");
+  }
+
+  bool agrees(const std::string &name, const El::BigFloat &pmp_value,
+              const El::BigFloat &sdpb_value, const El::BigFloat &tolerance)
+  {
+    const El::BigFloat scale(El::Max(El::BigFloat(1), El::Abs(sdpb_value)));
+    const bool result(El::Abs(pmp_value - sdpb_value) <= tolerance * scale);
+    if(El::mpi::Rank() == 0)
+      {
+        std::cout << (result ? "Agree   : " : "Disagree: ") << name
+                  << "\n  solve_pmp: " << pmp_value
+                  << "\n  sdpb     : " << sdpb_value << '\n';
+      }
+    return result;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  El::Environment env(argc, argv);
+
+  try
+    {
+      if(argc < 3)
+        {
+          throw std::runtime_error(
+            "Usage: solve_pmp_test INPUT OUT_TXT [sdpb options]");
+        }
+      const boost::filesystem::path input_file(argv[1]), out_path(argv[2]);
+      std::vector<char *> sdpb_argv({argv[0]});
+      sdpb_argv.insert(sdpb_argv.end(), argv + 3, argv + argc);
+      SDP_Solver_Parameters parameters(sdpb_argv.size(), sdpb_argv.data());
+      if(!parameters.is_valid())
+        {
+          return 1;
+        }
+
+      El::gmp::SetPrecision(parameters.precision);
+      // El::gmp wants base-2 bits, but boost::multiprecision wants
+      // base-10 digits.
+      Boost_Float::default_precision(parameters.precision * log(2)
+                                     / log(10));
+
+      std::vector<El::BigFloat> objectives, normalization;
+      std::vector<Positive_Matrix_With_Prefactor> matrices;
+      read_input(input_file, objectives, normalization, matrices);
+
+      Timers timers(parameters.verbosity >= Verbosity::debug);
+      const PMP_Solution solution(solve_pmp(El::mpi::COMM_WORLD, objectives,
+                                            normalization, matrices,
+                                            parameters, timers));
+
+      const El::BigFloat &tolerance(parameters.duality_gap_threshold);
+      const bool primal_agrees(
+        agrees("primalObjective", solution.primal_objective,
+               read_out_value(out_path, "primalObjective"), tolerance)),
+        dual_agrees(agrees("dualObjective", solution.dual_objective,
+                           read_out_value(out_path, "dualObjective"),
+                           tolerance));
+      return (primal_agrees && dual_agrees) ? 0 : 1;
+    }
+  catch(std::exception &e)
+    {
+      El::ReportException(e);
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+  catch(...)
+    {
+      El::mpi::Abort(El::mpi::COMM_WORLD, 1);
+    }
+}
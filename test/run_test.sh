@@ -23,6 +23,233 @@ else
     echo "FAIL SDPB"
     result=1
 fi
+
+# These options change how the search direction is computed, but not
+# the answer, so they should reproduce the same output.  QCholeskyMode
+# only differs with more than one node, and replicatedFactorThreshold
+# only with blocks split across processes, so they use two processes.
+rm -rf test/io_tests
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --maxQMemory=1
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS maxQMemory"
+else
+    echo "FAIL maxQMemory"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --QCholeskyMode=node
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS QCholeskyMode=node"
+else
+    echo "FAIL QCholeskyMode=node"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --iterativeSchurThreshold=1 --iterativeSchurTolerance=1e-300
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS iterativeSchurThreshold"
+else
+    echo "FAIL iterativeSchurThreshold"
+    result=1
+fi
+rm -rf test/io_tests
+
+# With more than one process and no block_timings file, there is a
+# timing run first, which has to cope with blocks that are never
+# factored.
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --iterativeSchurThreshold=1 --iterativeSchurTolerance=1e-300
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ] && [ -f test/io_tests/ck/block_timings ]
+then
+    echo "PASS iterativeSchurThreshold timing run"
+else
+    echo "FAIL iterativeSchurThreshold timing run"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --iterativeSchurThreshold=1 --iterativeSchurTolerance=1e-300 --cacheIterativeSchurBlocks
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS cacheIterativeSchurBlocks"
+else
+    echo "FAIL cacheIterativeSchurBlocks"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --iterativeQThreshold=1 --iterativeSchurTolerance=1e-300
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS iterativeQThreshold"
+else
+    echo "FAIL iterativeQThreshold"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --iterativeQThreshold=1 --iterativeSchurTolerance=1e-300
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ] && [ -f test/io_tests/ck/block_timings ]
+then
+    echo "PASS iterativeQThreshold timing run"
+else
+    echo "FAIL iterativeQThreshold timing run"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --recomputeSchurOffDiagonal
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS recomputeSchurOffDiagonal"
+else
+    echo "FAIL recomputeSchurOffDiagonal"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=2 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --replicatedFactorThreshold=1000
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS replicatedFactorThreshold"
+else
+    echo "FAIL replicatedFactorThreshold"
+    result=1
+fi
+rm -rf test/io_tests
+
+# Flipping the sign of the objective makes test/test unbounded, so
+# it should stop with a certificate of infeasibility.  A feasible
+# problem should not be affected by the check.
+rm -rf test/io_tests
+mkdir -p test/io_tests
+sed 's#<elt>-1</elt>#<elt>1</elt>#' test/test.xml > test/io_tests/infeasible.xml
+./build/pvm2sdp 1024 test/io_tests/infeasible.xml test/io_tests/infeasible
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/io_tests/infeasible -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --infeasibilityThreshold=1e-10
+if grep -q "terminateReason = \"found \(primal\|dual\) infeasibility certificate\";" test/io_tests/out/out.txt
+then
+    echo "PASS infeasibilityThreshold infeasible"
+else
+    echo "FAIL infeasibilityThreshold infeasible"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --infeasibilityThreshold=1e-10
+diff test/io_tests/out test/test_out_orig
+if [ $? == 0 ]
+then
+    echo "PASS infeasibilityThreshold feasible"
+else
+    echo "FAIL infeasibilityThreshold feasible"
+    result=1
+fi
+rm -rf test/io_tests
+
+# The drivers that solve more than one SDP, or balance blocks without a
+# timing run.  Each one should find the same optimum as the plain run.
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --batchObjectives test/test/objectives test/test/objectives
+if diff test/io_tests/out/0 test/test_out_orig && grep -q "terminateReason = \"found primal-dual optimal solution\";" test/io_tests/out/1/out.txt
+then
+    echo "PASS batchObjectives"
+else
+    echo "FAIL batchObjectives"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --findPrimalFeasible --findDualFeasible --bisectionPoints test/test/objectives test/test/objectives
+if grep -q "boundary  = {};" test/io_tests/out/bisection.txt && [ -f test/io_tests/out/0/out.txt ] && [ -f test/io_tests/out/1/out.txt ]
+then
+    echo "PASS bisectionPoints"
+else
+    echo "FAIL bisectionPoints"
+    result=1
+fi
+rm -rf test/io_tests
+
+# With a single iteration and no feasibility checks, the first point
+# exceeds maxIterations.  That is inconclusive, which should stop the
+# bisection cleanly rather than with an error.
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --maxIterations=1 --bisectionPoints test/test/objectives test/test/objectives
+if [ $? == 0 ] && grep -q "inconclusive = {0};" test/io_tests/out/bisection.txt && [ ! -d test/io_tests/out/1 ]
+then
+    echo "PASS bisectionPoints inconclusive"
+else
+    echo "FAIL bisectionPoints inconclusive"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck_warm -o test/io_tests/out_warm --warmStartDir test/io_tests/ck > test/io_tests/warm.log
+if grep -q "Warm starting from" test/io_tests/warm.log && grep -q "terminateReason = \"found primal-dual optimal solution\";" test/io_tests/out_warm/out.txt
+then
+    echo "PASS warmStartDir"
+else
+    echo "FAIL warmStartDir"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --packedSdpDirs test/test/
+if diff test/io_tests/out/0 test/test_out_orig && diff test/io_tests/out/1 test/test_out_orig
+then
+    echo "PASS packedSdpDirs"
+else
+    echo "FAIL packedSdpDirs"
+    result=1
+fi
+rm -rf test/io_tests
+
+mkdir -p test/io_tests
+printf "cholesky=100\ntrsm=100\nsyrk=100\nprecision=1024\nprecisionExponent=1.6\n" > test/io_tests/block_cost_model
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=2 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --blockCostModel test/io_tests/block_cost_model
+if [ -f test/io_tests/ck/block_timings ] && grep -q "terminateReason = \"found primal-dual optimal solution\";" test/io_tests/out/out.txt
+then
+    echo "PASS blockCostModel"
+else
+    echo "FAIL blockCostModel"
+    result=1
+fi
+rm -rf test/io_tests
+
+mpirun -n 2 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=2 -s test/test/ -c test/io_tests/ck -o test/io_tests/out --verbosity=0 --calibrateBlockCosts
+if [ -f test/io_tests/ck/block_timings ] && grep -q "terminateReason = \"found primal-dual optimal solution\";" test/io_tests/out/out.txt
+then
+    echo "PASS calibrateBlockCosts"
+else
+    echo "FAIL calibrateBlockCosts"
+    result=1
+fi
+rm -rf test/io_tests
+
+# test/toy_damped.json is test/test.xml in the format of sdp2input.
+# solve_pmp should find the same objectives as sdp2input and sdpb.
+mkdir -p test/io_tests
+mpirun -n 1 --quiet ./build/sdp2input --precision=1024 --input=test/toy_damped.json --output=test/io_tests/toy_damped
+mpirun -n 1 --quiet ./build/sdpb --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/io_tests/toy_damped -c test/io_tests/ck -o test/io_tests/out --verbosity=0
+mpirun -n 1 --quiet ./build/solve_pmp_test test/toy_damped.json test/io_tests/out/out.txt --precision=1024 --noFinalCheckpoint --procsPerNode=1 -s test/io_tests/toy_damped -c test/io_tests/pmp_ck --verbosity=0 > /dev/null
+if [ $? == 0 ]
+then
+    echo "PASS solve_pmp"
+else
+    echo "FAIL solve_pmp"
+    result=1
+fi
 rm -rf test/io_tests
 
 mkdir -p test/io_tests